@@ -0,0 +1,33 @@
+clc
+% Real input, only the lgth/2+1 non-redundant bins are computed
+lgth = 10000000;
+inpArr = rand(1,lgth);
+
+inputArray = libpointer('singlePtr',single(inpArr));
+% Preallocate the output array (lgth/2+1 complex bins)
+outputArray = libpointer('singlePtr',zeros(1,2*(floor(lgth/2)+1),'single'));
+
+% Load the library
+if ~libisloaded('myfft')
+    loadlibrary('myfft', 'fft10.h');
+end
+
+FFT10_REAL = 8;
+plan = calllib('myfft', 'fft10_plan_create', uint64(lgth), uint32(FFT10_REAL));
+
+% Call the C function
+tic
+calllib('myfft', 'fft10_execute_r2c', plan, inputArray, outputArray);
+toc
+
+calllib('myfft', 'fft10_plan_destroy', plan);
+calllib('myfft', 'fft10_cleanup');
+% Unload the library
+unloadlibrary('myfft');
+
+tic
+fft_res = fft(inpArr);
+toc
+
+final_output = outputArray.Value(1:2:end-1) + 1j*outputArray.Value(2:2:end);
+max(abs(final_output - fft_res(1:floor(lgth/2)+1)))/max(abs(fft_res))
@@ -35,4 +35,5 @@ toc
 
 
 final_output = outputArray.Value(1:2:end-1) + 1j*outputArray.Value(2:2:end);
-max(abs(final_output) - abs(fft_res))
\ No newline at end of file
+% relative error of the complex values (fft10_bench reports the same for any size)
+max(abs(final_output - fft_res))/max(abs(fft_res))
\ No newline at end of file
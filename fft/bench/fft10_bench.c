@@ -0,0 +1,746 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_bench.c
+ * Description: Benchmark and accuracy harness of the fft10 library. Sweeps
+ * transform sizes, batch counts and thread counts, measures the time per point
+ * and compares the results with a double precision reference transform. The
+ * results are written as CSV or JSON so that runs of different versions can be
+ * compared by a script.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - add benchmark and accuracy harness
+ * 18.10.2026 - read the clock once per round of executions
+ * 18.10.2026 - --precision compares the float, double, Q15 and Q31 plans
+ * 18.10.2026 - --measure and --wisdom for plans of the measuring planner
+ * 18.10.2026 - --profile dumps the counters of a FFT10_PROFILE build
+ * 18.10.2026 - "many" rows check the output of fft10_execute_many
+ * 18.10.2026 - define _POSIX_C_SOURCE for clock_gettime under -std=c99
+ *
+ * ----------------------------------------------------------------------------
+ * Usage:
+ * ----------------------------------------------------------------------------
+ *     gcc -O2 -I../include -o fft10_bench fft10_bench.c ../src/fft10*.c -lm -pthread
+ *     ./fft10_bench --sizes 10,1000,1000000 --batch 1,64 --threads 1,8 --format json
+ *     ./fft10_bench --help
+ *
+ * ----------------------------------------------------------------------------
+ * Dependencies:
+ * ----------------------------------------------------------------------------
+ * fft10 library, pthreads
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Every row is one (size, batch, threads, mode) combination:
+ *     mode "single"  fft10_execute on one out-of-place transform
+ *     mode "many"    fft10_execute_many on batch transforms
+ *     mode "loop"    batch calls of fft10_execute, the baseline of "many"
+ * and precision (float, double, q15 or q31). The double and fixed point plans
+ * have no fft10_execute_many, so they run the "single" and "loop" modes only.
+ * ns_per_point is the best time of --repeat measurements divided by
+ * batch*size. gflops uses the usual 5*n*log2(n) operation count of a complex
+ * transform, gbytes_per_s counts one read and one write of every point and is
+ * a lower bound of the memory traffic.
+ * rel_rms = sqrt(sum |X - R|^2 / sum |R|^2) and rel_max = max |X - R| / max |R|
+ * compare the first transform of a row with the double precision reference R,
+ * computed for sizes up to --check-max (empty fields above); "many" rows check
+ * the first and the last transform written by fft10_execute_many itself and
+ * report the larger error. snr_db = -20*log10(rel_rms). Fixed point rows
+ * transform the input rounded to Q15/Q31 and are compared with the reference
+ * of that rounded input, scaled by the block exponent.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#define _POSIX_C_SOURCE 199309L     // clock_gettime under -std=c99
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdint.h>
+#include <time.h>
+#include "../include/fft10.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#define BENCH_PI        3.14159265358979323846
+#define BENCH_MAX_LIST  64
+
+#define BENCH_FLOAT   0
+#define BENCH_DOUBLE  1
+#define BENCH_Q15     2
+#define BENCH_Q31     3
+
+static const char*    precision_names[4] = { "float", "double", "q15", "q31" };
+static const unsigned precision_flags[4] = { FFT10_ESTIMATE, FFT10_DOUBLE, FFT10_Q15, FFT10_Q31 };
+static const size_t   precision_bytes[4] = { sizeof(float), sizeof(double), sizeof(int16_t), sizeof(int32_t) };
+
+typedef struct {
+    size_t  sizes[BENCH_MAX_LIST];
+    int     nsizes;
+    size_t  batches[BENCH_MAX_LIST];
+    int     nbatches;
+    size_t  threads[BENCH_MAX_LIST];
+    int     nthreads;
+    int     measure;        // FFT10_MEASURE plans
+    const char* wisdom;     // read before and written after the run
+    const char* profile;    // JSON dump of the fft10 profile counters
+    int     precisions[4];
+    int     nprecisions;
+    size_t  max_points;     // largest batch*size of a row
+    size_t  check_max;      // largest size compared with the reference
+    double  min_time;       // seconds per measurement
+    int     repeat;
+    int     json;
+    FILE*   out;
+} bench_config;
+
+typedef struct {
+    size_t       n;
+    size_t       batch;
+    size_t       threads;
+    const char*  mode;
+    int          precision;
+    double       ns_per_point;
+    double       gflops;
+    double       gbytes_per_s;
+    double       rel_rms;       // < 0 if not checked
+    double       rel_max;
+    double       snr_db;
+} bench_row;
+
+static double now_seconds(void) {
+#ifdef _WIN32
+    LARGE_INTEGER f, c;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&c);
+    return (double)c.QuadPart/(double)f.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1e-9*(double)ts.tv_nsec;
+#endif
+}
+
+static size_t cpu_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return (size_t)si.dwNumberOfProcessors;
+#else
+    long c = sysconf(_SC_NPROCESSORS_ONLN);
+    return c > 0 ? (size_t)c : 1;
+#endif
+}
+
+/* comma separated list of sizes, 1e6 style allowed */
+static int parse_list(const char* s, size_t* list) {
+    int count = 0;
+
+    while(*s && count < BENCH_MAX_LIST)
+    {
+        char*  end;
+        double v = strtod(s, &end);
+        if(end == s || v < 1)
+        {
+            return -1;
+        }
+        list[count++] = (size_t)(v + 0.5);
+        s = *end == ',' ? end + 1 : end;
+        if(*end && *end != ',')
+        {
+            return -1;
+        }
+    }
+    return count;
+}
+
+static size_t smallest_factor(size_t n) {
+    for(size_t p = 2; p*p <= n; p++)
+    {
+        if(n % p == 0)
+        {
+            return p;
+        }
+    }
+    return n;
+}
+
+static size_t largest_factor(size_t n) {
+    size_t p = 1;
+
+    while(n > 1)
+    {
+        p = smallest_factor(n);
+        n /= p;
+    }
+    return p;
+}
+
+/*
+ * Double precision reference of length n, decimation in time over the
+ * smallest prime factor. W holds W_N^j for the top level length N, which is a
+ * multiple of every sub-length n. The result goes to X, scratch is used for
+ * the sub-transforms.
+ */
+static void ref_fft(const double* x, size_t xs, size_t n, double* X, double* scratch, const double* W, size_t N) {
+    size_t p, m;
+
+    if(n == 1)
+    {
+        X[0] = x[0];
+        X[1] = x[1];
+        return;
+    }
+    p = smallest_factor(n);
+    m = n/p;
+    for(size_t r = 0; r < p; r++)
+    {
+        ref_fft(x + 2*r*xs, xs*p, m, scratch + 2*r*m, X + 2*r*m, W, N);
+    }
+
+    for(size_t q = 0; q < p; q++)
+    {
+        for(size_t k = 0; k < m; k++)
+        {
+            size_t kk = k + m*q;
+            double sr = 0.0, si = 0.0;
+            for(size_t r = 0; r < p; r++)
+            {
+                size_t        e = (r*kk % n)*(N/n);
+                const double* y = scratch + 2*(r*m + k);
+                sr += y[0]*W[2*e]   - y[1]*W[2*e+1];
+                si += y[0]*W[2*e+1] + y[1]*W[2*e];
+            }
+            X[2*kk]   = sr;
+            X[2*kk+1] = si;
+        }
+    }
+}
+
+/* comma separated list of precision names */
+static int parse_precisions(const char* s, int* list) {
+    int count = 0;
+
+    while(*s && count < 4)
+    {
+        size_t len = strcspn(s, ",");
+        int    p;
+        for(p = 0; p < 4; p++)
+        {
+            if(strlen(precision_names[p]) == len && strncmp(s, precision_names[p], len) == 0)
+            {
+                break;
+            }
+        }
+        if(p == 4)
+        {
+            return -1;
+        }
+        list[count++] = p;
+        s += s[len] == ',' ? len + 1 : len;
+    }
+    return count;
+}
+
+/* reference transform of the n complex values x, NULL if out of memory */
+static double* reference(const double* x, size_t n) {
+    double* buf = (double*)malloc(8*n*sizeof(double));
+    double* X;
+
+    if(!buf)
+    {
+        return NULL;
+    }
+    for(size_t j = 0; j < 2*n; j++)
+    {
+        buf[j] = x[j];
+    }
+    for(size_t j = 0; j < n; j++)
+    {
+        buf[6*n + 2*j]   = cos(-2.0*BENCH_PI*(double)j/(double)n);
+        buf[6*n + 2*j+1] = sin(-2.0*BENCH_PI*(double)j/(double)n);
+    }
+    X = (double*)malloc(2*n*sizeof(double));
+    if(X)
+    {
+        ref_fft(buf, 1, n, X, buf + 2*n, buf + 6*n, n);
+    }
+    free(buf);
+    return X;
+}
+
+static void compare(const double* X, const double* R, size_t n, bench_row* row) {
+    double err2 = 0.0, ref2 = 0.0, errmax = 0.0, refmax = 0.0;
+
+    for(size_t k = 0; k < n; k++)
+    {
+        double dr = X[2*k] - R[2*k], di = X[2*k+1] - R[2*k+1];
+        double e2 = dr*dr + di*di;
+        double r2 = R[2*k]*R[2*k] + R[2*k+1]*R[2*k+1];
+        err2 += e2;
+        ref2 += r2;
+        errmax = e2 > errmax ? e2 : errmax;
+        refmax = r2 > refmax ? r2 : refmax;
+    }
+    row->rel_rms = ref2 > 0.0 ? sqrt(err2/ref2) : sqrt(err2);
+    row->rel_max = refmax > 0.0 ? sqrt(errmax/refmax) : sqrt(errmax);
+    row->snr_db  = err2 > 0.0 ? -20.0*log10(row->rel_rms) : INFINITY;
+}
+
+/* the 2n values x (in [-0.5, 0.5)) in the sample type of precision, written to y */
+static void convert_input(int precision, const float* x, size_t n, void* y) {
+    for(size_t j = 0; j < 2*n; j++)
+    {
+        switch(precision)
+        {
+        case BENCH_FLOAT:  ((float*)y)[j]   = x[j]; break;
+        case BENCH_DOUBLE: ((double*)y)[j]  = x[j]; break;
+        case BENCH_Q15:    ((int16_t*)y)[j] = (int16_t)lrint(x[j]*32768.0); break;
+        default:           ((int32_t*)y)[j] = (int32_t)llrint(x[j]*2147483648.0); break;
+        }
+    }
+}
+
+/* the 2n values y of precision with block exponent e as doubles */
+static void convert_output(int precision, const void* y, int e, size_t n, double* x) {
+    for(size_t j = 0; j < 2*n; j++)
+    {
+        switch(precision)
+        {
+        case BENCH_FLOAT:  x[j] = ((const float*)y)[j]; break;
+        case BENCH_DOUBLE: x[j] = ((const double*)y)[j]; break;
+        case BENCH_Q15:    x[j] = ldexp(((const int16_t*)y)[j], e - 15); break;
+        default:           x[j] = ldexp(((const int32_t*)y)[j], e - 31); break;
+        }
+    }
+}
+
+/* one transform of precision, returns the block exponent of fixed point results */
+static int execute_one(int precision, const fft10_plan* plan, const void* x, void* X) {
+    switch(precision)
+    {
+    case BENCH_FLOAT:  fft10_execute(plan, (const float*)x, (float*)X); return 0;
+    case BENCH_DOUBLE: fft10_execute_d(plan, (const double*)x, (double*)X); return 0;
+    case BENCH_Q15:    return fft10_execute_q15(plan, (const int16_t*)x, (int16_t*)X);
+    default:           return fft10_execute_q31(plan, (const int32_t*)x, (int32_t*)X);
+    }
+}
+
+/* one run of a row's mode on batch transforms of x into X */
+static void run_mode(const char* mode, int precision, const fft10_plan* plan, size_t n, size_t batch,
+                     const void* x, void* X) {
+    size_t dist = 2*n*precision_bytes[precision];
+
+    if(strcmp(mode, "many") == 0)
+    {
+        fft10_execute_many(plan, batch, (const float*)x, 1, n, (float*)X, 1, n);
+    }
+    else
+    {
+        for(size_t b = 0; b < batch; b++)
+        {
+            execute_one(precision, plan, (const char*)x + b*dist, (char*)X + b*dist);
+        }
+    }
+}
+
+/* best time of cfg->repeat measurements of at least cfg->min_time seconds each */
+static double measure(const bench_config* cfg, const char* mode, int precision, const fft10_plan* plan,
+                      size_t n, size_t batch, const void* x, void* X) {
+    double best = 0.0;
+
+    run_mode(mode, precision, plan, n, batch, x, X);
+    for(int r = 0; r < cfg->repeat; r++)
+    {
+        // the clock is read once per round, so short transforms are not timed with its overhead
+        size_t iters = 1;
+        double t;
+        for(;;)
+        {
+            double t0 = now_seconds();
+            for(size_t i = 0; i < iters; i++)
+            {
+                run_mode(mode, precision, plan, n, batch, x, X);
+            }
+            t = now_seconds() - t0;
+            if(t >= cfg->min_time)
+            {
+                break;
+            }
+            iters *= 2;
+        }
+
+        t /= (double)iters;
+        best = (r == 0 || t < best) ? t : best;
+    }
+    return best;
+}
+
+static void print_header(const bench_config* cfg) {
+    if(cfg->json)
+    {
+        fprintf(cfg->out, "{\n  \"isa\": %d,\n  \"results\": [", fft10_get_isa());
+    }
+    else
+    {
+        fprintf(cfg->out, "size,batch,threads,mode,precision,isa,ns_per_point,gflops,gbytes_per_s,rel_rms,rel_max,snr_db\n");
+    }
+}
+
+static void print_row(const bench_config* cfg, const bench_row* row, int first) {
+    char rms[32] = "", max[32] = "", snr[32] = "";
+
+    if(row->rel_rms >= 0.0)
+    {
+        snprintf(rms, sizeof(rms), "%.3e", row->rel_rms);
+        snprintf(max, sizeof(max), "%.3e", row->rel_max);
+        // an exact result has no finite snr, JSON has no infinity
+        snprintf(snr, sizeof(snr), "%.2f", isinf(row->snr_db) ? 999.0 : row->snr_db);
+    }
+    if(cfg->json)
+    {
+        fprintf(cfg->out, "%s\n    {\"size\": %zu, \"batch\": %zu, \"threads\": %zu, \"mode\": \"%s\", "
+                "\"precision\": \"%s\", \"isa\": %d, \"ns_per_point\": %.4f, \"gflops\": %.3f, "
+                "\"gbytes_per_s\": %.3f, \"rel_rms\": %s, \"rel_max\": %s, \"snr_db\": %s}",
+                first ? "" : ",", row->n, row->batch, row->threads, row->mode,
+                precision_names[row->precision], fft10_get_isa(),
+                row->ns_per_point, row->gflops, row->gbytes_per_s,
+                rms[0] ? rms : "null", max[0] ? max : "null", snr[0] ? snr : "null");
+    }
+    else
+    {
+        fprintf(cfg->out, "%zu,%zu,%zu,%s,%s,%d,%.4f,%.3f,%.3f,%s,%s,%s\n",
+                row->n, row->batch, row->threads, row->mode, precision_names[row->precision],
+                fft10_get_isa(), row->ns_per_point, row->gflops, row->gbytes_per_s, rms, max, snr);
+    }
+    fflush(cfg->out);
+}
+
+static void print_footer(const bench_config* cfg) {
+    if(cfg->json)
+    {
+        fprintf(cfg->out, "\n  ]\n}\n");
+    }
+}
+
+/* all rows of one size and precision on the input x, returns the number of rows written */
+static int bench_precision(const bench_config* cfg, size_t n, int precision, size_t maxb, const float* x, int first) {
+    static const char* modes[] = { "single", "many", "loop" };
+    size_t             bytes   = 2*maxb*n*precision_bytes[precision];
+    void*              xin;
+    void*              X;
+    double*            xd      = NULL;
+    double*            Xd      = NULL;
+    double*            R       = NULL;
+    fft10_plan*        plan;
+    int                rows    = 0;
+
+    plan = fft10_plan_create(n, precision_flags[precision] | (cfg->measure ? FFT10_MEASURE : 0));
+    xin  = malloc(bytes);
+    X    = malloc(bytes);
+    if(!plan || !xin || !X)
+    {
+        fprintf(stderr, "fft10_bench: size %zu %s skipped, out of memory or unsupported\n", n, precision_names[precision]);
+        goto done;
+    }
+    convert_input(precision, x, maxb*n, xin);
+
+    // the generic radix of the reference is O(n*p), so large prime factors are only checked for small n
+    if(n <= cfg->check_max && (n <= 20000 || largest_factor(n) <= 1000))
+    {
+        xd = (double*)malloc(2*n*sizeof(double));
+        Xd = (double*)malloc(2*n*sizeof(double));
+        if(xd && Xd)
+        {
+            convert_output(precision, xin, 0, n, xd);
+            R = reference(xd, n);
+        }
+    }
+
+    for(int t = 0; t < cfg->nthreads; t++)
+    {
+        fft10_set_threads((int)cfg->threads[t]);
+        for(int b = 0; b < cfg->nbatches; b++)
+        {
+            size_t batch = cfg->batches[b];
+            if(batch*n > cfg->max_points)
+            {
+                continue;
+            }
+            for(int m = 0; m < 3; m++)
+            {
+                bench_row row;
+                double    sec;
+
+                // a single transform has no batch, the loop baseline only makes sense beside "many"
+                if((m == 0) != (batch == 1) || (m == 1 && precision != BENCH_FLOAT))
+                {
+                    continue;
+                }
+                sec = measure(cfg, modes[m], precision, plan, n, batch, xin, X);
+
+                row.n            = n;
+                row.batch        = batch;
+                row.threads      = cfg->threads[t];
+                row.mode         = modes[m];
+                row.precision    = precision;
+                row.ns_per_point = 1e9*sec/(double)(batch*n);
+                row.gflops       = n > 1 ? 5.0*(double)n*log2((double)n)*(double)batch/sec*1e-9 : 0.0;
+                row.gbytes_per_s = 2.0*2*precision_bytes[precision]*(double)(batch*n)/sec*1e-9;
+                row.rel_rms      = -1.0;
+                row.rel_max      = -1.0;
+                row.snr_db       = 0.0;
+                if(R && m == 1)
+                {
+                    // the output of the batch engine itself, its first and its last transform
+                    const float*  xl = (const float*)xin + 2*(batch-1)*n;
+                    const float*  Xl = (const float*)X + 2*(batch-1)*n;
+                    double*       Rl;
+                    bench_row     last = row;
+
+                    convert_output(precision, X, 0, n, Xd);
+                    compare(Xd, R, n, &row);
+                    convert_output(precision, xl, 0, n, xd);
+                    Rl = reference(xd, n);
+                    if(Rl)
+                    {
+                        convert_output(precision, Xl, 0, n, Xd);
+                        compare(Xd, Rl, n, &last);
+                        row.rel_rms = last.rel_rms > row.rel_rms ? last.rel_rms : row.rel_rms;
+                        row.rel_max = last.rel_max > row.rel_max ? last.rel_max : row.rel_max;
+                        row.snr_db  = last.snr_db < row.snr_db ? last.snr_db : row.snr_db;
+                    }
+                    free(Rl);
+                }
+                else if(R)
+                {
+                    int e = execute_one(precision, plan, xin, X);
+                    convert_output(precision, X, e, n, Xd);
+                    compare(Xd, R, n, &row);
+                }
+                print_row(cfg, &row, first && rows == 0);
+                rows++;
+            }
+        }
+    }
+
+done:
+    free(R);
+    free(xd);
+    free(Xd);
+    free(xin);
+    free(X);
+    fft10_plan_destroy(plan);
+    return rows;
+}
+
+/* all rows of one size, returns the number of rows written */
+static int bench_size(const bench_config* cfg, size_t n, int first) {
+    size_t  maxb = 1;
+    float*  x;
+    int     rows = 0;
+
+    for(int b = 0; b < cfg->nbatches; b++)
+    {
+        if(cfg->batches[b] > maxb && cfg->batches[b]*n <= cfg->max_points)
+        {
+            maxb = cfg->batches[b];
+        }
+    }
+
+    x = (float*)malloc(2*maxb*n*sizeof(float));
+    if(!x)
+    {
+        fprintf(stderr, "fft10_bench: size %zu skipped, out of memory\n", n);
+        return 0;
+    }
+    srand(1);
+    for(size_t j = 0; j < 2*maxb*n; j++)
+    {
+        x[j] = (float)rand()/(float)RAND_MAX - 0.5f;
+    }
+
+    for(int p = 0; p < cfg->nprecisions; p++)
+    {
+        rows += bench_precision(cfg, n, cfg->precisions[p], maxb, x, first && rows == 0);
+    }
+    free(x);
+    return rows;
+}
+
+static void usage(void) {
+    fprintf(stderr,
+        "usage: fft10_bench [options]\n"
+        "  --sizes LIST      transform sizes (default 10,100,...,1e8)\n"
+        "  --batch LIST      batch counts (default 1,16,256)\n"
+        "  --threads LIST    thread counts (default 1 and the number of cpus)\n"
+        "  --max-points N    skip rows with batch*size above N (default 1e8)\n"
+        "  --check-max N     compare sizes up to N with the reference (default 1e6)\n"
+        "  --min-time SEC    length of one measurement (default 0.2)\n"
+        "  --repeat N        measurements per row, the best is reported (default 3)\n"
+        "  --precision LIST  float, double, q15 and/or q31 (default float)\n"
+        "  --measure         plans of the measuring planner (FFT10_MEASURE)\n"
+        "  --wisdom FILE     import the wisdom of FILE first and export it at the end\n"
+        "  --profile FILE    write the per-stage counters (library built with -DFFT10_PROFILE)\n"
+        "  --isa N           0 scalar, 1 SSE2, 2 AVX2, 3 AVX-512 (default best)\n"
+        "  --format csv|json output format (default csv)\n"
+        "  --output FILE     write the results to FILE (default stdout)\n");
+}
+
+int main(int argc, char** argv) {
+    bench_config  cfg;
+    size_t        ncpu = cpu_count();
+    int           rows = 0;
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.nsizes = parse_list("10,100,1e3,1e4,1e5,1e6,1e7,1e8", cfg.sizes);
+    cfg.nbatches = parse_list("1,16,256", cfg.batches);
+    cfg.nprecisions = parse_precisions("float", cfg.precisions);
+    cfg.threads[0] = 1;
+    cfg.threads[1] = ncpu;
+    cfg.nthreads   = ncpu > 1 ? 2 : 1;
+    cfg.max_points = 100000000;
+    cfg.check_max  = 1000000;
+    cfg.min_time   = 0.2;
+    cfg.repeat     = 3;
+    cfg.out        = stdout;
+
+    for(int i = 1; i < argc; i++)
+    {
+        const char* opt = argv[i];
+        const char* val = i + 1 < argc ? argv[i+1] : NULL;
+        int         ok  = val != NULL;
+
+        if(strcmp(opt, "--help") == 0 || strcmp(opt, "-h") == 0)
+        {
+            usage();
+            return 0;
+        }
+        else if(ok && strcmp(opt, "--sizes") == 0)
+        {
+            ok = (cfg.nsizes = parse_list(val, cfg.sizes)) > 0;
+        }
+        else if(ok && strcmp(opt, "--batch") == 0)
+        {
+            ok = (cfg.nbatches = parse_list(val, cfg.batches)) > 0;
+        }
+        else if(ok && strcmp(opt, "--threads") == 0)
+        {
+            ok = (cfg.nthreads = parse_list(val, cfg.threads)) > 0;
+        }
+        else if(strcmp(opt, "--measure") == 0)
+        {
+            cfg.measure = 1;
+            continue;
+        }
+        else if(ok && strcmp(opt, "--wisdom") == 0)
+        {
+            cfg.wisdom = val;
+        }
+        else if(ok && strcmp(opt, "--profile") == 0)
+        {
+            cfg.profile = val;
+        }
+        else if(ok && strcmp(opt, "--precision") == 0)
+        {
+            ok = (cfg.nprecisions = parse_precisions(val, cfg.precisions)) > 0;
+        }
+        else if(ok && strcmp(opt, "--max-points") == 0)
+        {
+            ok = parse_list(val, &cfg.max_points) == 1;
+        }
+        else if(ok && strcmp(opt, "--check-max") == 0)
+        {
+            ok = parse_list(val, &cfg.check_max) == 1;
+        }
+        else if(ok && strcmp(opt, "--min-time") == 0)
+        {
+            cfg.min_time = atof(val);
+        }
+        else if(ok && strcmp(opt, "--repeat") == 0)
+        {
+            cfg.repeat = atoi(val);
+            ok = cfg.repeat > 0;
+        }
+        else if(ok && strcmp(opt, "--isa") == 0)
+        {
+            fft10_set_isa(atoi(val));
+        }
+        else if(ok && strcmp(opt, "--format") == 0)
+        {
+            cfg.json = strcmp(val, "json") == 0;
+            ok = cfg.json || strcmp(val, "csv") == 0;
+        }
+        else if(ok && strcmp(opt, "--output") == 0)
+        {
+            cfg.out = fopen(val, "w");
+            ok = cfg.out != NULL;
+        }
+        else
+        {
+            ok = 0;
+        }
+
+        if(!ok)
+        {
+            fprintf(stderr, "fft10_bench: bad option %s\n", opt);
+            usage();
+            return 1;
+        }
+        i++;
+    }
+
+    if(cfg.wisdom)
+    {
+        // a missing file is the normal first run
+        fft10_wisdom_import(cfg.wisdom);
+    }
+    if(cfg.profile && fft10_profile_enable(FFT10_PROFILE_TIME | FFT10_PROFILE_HW) == 0)
+    {
+        fprintf(stderr, "fft10_bench: --profile needs the library built with -DFFT10_PROFILE\n");
+        cfg.profile = NULL;
+    }
+    print_header(&cfg);
+    for(int s = 0; s < cfg.nsizes; s++)
+    {
+        rows += bench_size(&cfg, cfg.sizes[s], rows == 0);
+    }
+    print_footer(&cfg);
+    if(cfg.profile && fft10_profile_dump(cfg.profile) != 0)
+    {
+        fprintf(stderr, "fft10_bench: could not write %s\n", cfg.profile);
+    }
+    if(cfg.wisdom && fft10_wisdom_export(cfg.wisdom) != 0)
+    {
+        fprintf(stderr, "fft10_bench: could not write %s\n", cfg.wisdom);
+    }
+
+    if(cfg.out != stdout)
+    {
+        fclose(cfg.out);
+    }
+    fft10_set_threads(1);
+    fft10_cleanup();
+    return 0;
+}
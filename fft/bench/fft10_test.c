@@ -0,0 +1,236 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_test.c
+ * Description: Accuracy test of the public interface of the fft10 library.
+ * Every entry point is run on random signals and compared with a direct
+ * double precision DFT (or direct convolution); the program exits with 1 if
+ * any error is above its tolerance. This file holds main and the shared
+ * helpers, the tests of each part of the API are in fft10_test_<part>.c.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - add test of the public entry points against a direct DFT
+ * 18.10.2026 - share the helpers through fft10_test.h for one test file per part of the API
+ *
+ * ----------------------------------------------------------------------------
+ * Usage:
+ * ----------------------------------------------------------------------------
+ *     gcc -O2 -I../include -o fft10_test fft10_test*.c ../src/fft10*.c -lm -pthread
+ *     ./fft10_test
+ *
+ * ----------------------------------------------------------------------------
+ * Dependencies:
+ * ----------------------------------------------------------------------------
+ * fft10 library, pthreads
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Every check prints one line with rel_rms = sqrt(sum |X - R|^2 / sum |R|^2) of
+ * the result X against the reference R and its tolerance. The complex plans
+ * are checked with every instruction set the cpu supports and with 1 and 4
+ * threads. fft10_execute_file and the wisdom check write temporary files to
+ * the current folder and remove them afterwards.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "fft10_test.h"
+
+int        test_failures;
+static int test_checks;
+
+void* xalloc(size_t bytes) {
+    void* p = malloc(bytes ? bytes : 1);
+
+    if(!p)
+    {
+        fprintf(stderr, "fft10_test: out of memory\n");
+        exit(2);
+    }
+    return p;
+}
+
+/* uniform values in [-0.5, 0.5) */
+void fill_random(float* x, size_t count) {
+    for(size_t j = 0; j < count; j++)
+    {
+        x[j] = (float)rand()/((float)RAND_MAX + 1.0f) - 0.5f;
+    }
+}
+
+double* to_double(const float* x, size_t count) {
+    double* d = xalloc(count*sizeof(double));
+
+    for(size_t j = 0; j < count; j++)
+    {
+        d[j] = x[j];
+    }
+    return d;
+}
+
+/* direct DFT of n complex values, x and X at strides of xs and Xs complex values, scaled by scale */
+void direct_dft(const double* x, size_t xs, double* X, size_t Xs, size_t n, int sign, double scale) {
+    double* w = xalloc(2*n*sizeof(double));
+
+    for(size_t j = 0; j < n; j++)
+    {
+        w[2*j]   = cos(2.0*TEST_PI*(double)j/(double)n);
+        w[2*j+1] = sign*sin(2.0*TEST_PI*(double)j/(double)n);
+    }
+    for(size_t k = 0; k < n; k++)
+    {
+        double re = 0.0, im = 0.0;
+        size_t t  = 0;
+
+        for(size_t j = 0; j < n; j++)
+        {
+            const double* a = x + 2*j*xs;
+
+            re += a[0]*w[2*t] - a[1]*w[2*t+1];
+            im += a[0]*w[2*t+1] + a[1]*w[2*t];
+            t  += k;
+            t   = t >= n ? t - n : t;
+        }
+        X[2*k*Xs]   = scale*re;
+        X[2*k*Xs+1] = scale*im;
+    }
+    free(w);
+}
+
+/* direct transform of a row-major array of complex values, axis by axis, in place */
+void direct_nd(double* a, int rank, const size_t* dims, int sign, double scale) {
+    size_t total = 1;
+
+    for(int d = 0; d < rank; d++)
+    {
+        total *= dims[d];
+    }
+    for(int d = 0; d < rank; d++)
+    {
+        size_t  n = dims[d], inner = 1;
+        double* line = xalloc(2*n*sizeof(double));
+
+        for(int e = d+1; e < rank; e++)
+        {
+            inner *= dims[e];
+        }
+        for(size_t base = 0; base < total; base++)
+        {
+            if((base / inner) % n != 0)
+            {
+                continue;
+            }
+            direct_dft(a + 2*base, inner, line, 1, n, sign, d == 0 ? scale : 1.0);
+            for(size_t j = 0; j < n; j++)
+            {
+                a[2*(base + j*inner)]   = line[2*j];
+                a[2*(base + j*inner)+1] = line[2*j+1];
+            }
+        }
+        free(line);
+    }
+}
+
+double rel_rms(const double* X, const double* R, size_t count) {
+    double num = 0.0, den = 0.0;
+
+    for(size_t j = 0; j < count; j++)
+    {
+        num += (X[j] - R[j])*(X[j] - R[j]);
+        den += R[j]*R[j];
+    }
+    return den > 0.0 ? sqrt(num/den) : sqrt(num);
+}
+
+double rel_rms_f(const float* X, const double* R, size_t count) {
+    double* d = to_double(X, count);
+    double  e = rel_rms(d, R, count);
+
+    free(d);
+    return e;
+}
+
+void check(const char* what, double err, double tol) {
+    int ok = err <= tol;        // false for NaN
+
+    test_checks++;
+    test_failures += !ok;
+    printf("%-48s rel_rms %.3e  tol %.0e  %s\n", what, err, tol, ok ? "ok" : "FAIL");
+}
+
+/* local_fft_radix10 on a strided part of x_in written to an offset of X_out */
+static void test_legacy(void) {
+    const int n = 100, read_from = 3, read_jump = 2, write_to = 5;
+    float*    x = xalloc(2*(size_t)(read_from + n*read_jump)*sizeof(float));
+    float*    X = xalloc(2*(size_t)(write_to + n)*sizeof(float));
+    double*   xd;
+    double*   R = xalloc(2*(size_t)n*sizeof(double));
+
+    fill_random(x, 2*(size_t)(read_from + n*read_jump));
+    xd = to_double(x, 2*(size_t)(read_from + n*read_jump));
+    direct_dft(xd + 2*read_from, (size_t)read_jump, R, 1, (size_t)n, -1, 1.0);
+    local_fft_radix10(read_from, read_jump, write_to, n, x, X);
+    check("local_fft_radix10 n=100 read_jump=2", rel_rms_f(X + 2*write_to, R, 2*(size_t)n), TEST_TOL_FLOAT);
+    free(x);
+    free(X);
+    free(xd);
+    free(R);
+}
+
+int main(void) {
+    int  last = -1;
+    char tag[32];
+
+    srand(10);
+    for(int isa = FFT10_ISA_SCALAR; isa <= FFT10_ISA_AVX512; isa++)
+    {
+        int used = fft10_set_isa(isa);
+
+        if(used == last)
+        {
+            continue;
+        }
+        last = used;
+        for(int threads = 1; threads <= 4; threads += 3)
+        {
+            fft10_set_threads(threads);
+            snprintf(tag, sizeof(tag), "isa=%d threads=%d", used, threads);
+            test_plans(tag);
+        }
+    }
+    fft10_set_isa(FFT10_ISA_AVX512);
+    fft10_set_threads(1);
+
+    test_many();
+    test_real();
+    test_precision();
+    test_file();
+    test_conv();
+    test_stft();
+    test_nd();
+    test_bins();
+    test_wisdom();
+    test_legacy();
+    fft10_cleanup();
+
+    printf("%d of %d checks failed\n", test_failures, test_checks);
+    return test_failures ? 1 : 0;
+}
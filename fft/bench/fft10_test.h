@@ -0,0 +1,59 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_test.h
+ * Description: Helpers shared by the accuracy tests of the fft10 library
+ * (direct reference transforms, error measure and the check counter) and the
+ * tests of each part of the API that main runs.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#ifndef __FFT10_TEST__H__
+#define __FFT10_TEST__H__
+
+#include <stddef.h>
+#include "../include/fft10.h"
+
+#define TEST_PI          3.14159265358979323846
+#define TEST_TOL_FLOAT   2e-6
+#define TEST_TOL_DOUBLE  1e-13
+#define TEST_TOL_Q15     5e-3
+#define TEST_TOL_Q31     1e-7
+
+/* checks that failed so far */
+extern int test_failures;
+
+/* malloc that exits on failure */
+void*   xalloc(size_t bytes);
+/* uniform values in [-0.5, 0.5) */
+void    fill_random(float* x, size_t count);
+/* double copy of count floats, freed by the caller */
+double* to_double(const float* x, size_t count);
+/* direct DFT of n complex values, x and X at strides of xs and Xs complex values, scaled by scale */
+void    direct_dft(const double* x, size_t xs, double* X, size_t Xs, size_t n, int sign, double scale);
+/* direct transform of a row-major array of complex values, axis by axis, in place */
+void    direct_nd(double* a, int rank, const size_t* dims, int sign, double scale);
+/* sqrt(sum |X - R|^2 / sum |R|^2) over count values */
+double  rel_rms(const double* X, const double* R, size_t count);
+double  rel_rms_f(const float* X, const double* R, size_t count);
+/* prints one line and counts a failure if err is above tol (or NaN) */
+void    check(const char* what, double err, double tol);
+
+/* the tests of each part of the API, run by main */
+void    test_plans(const char* tag);        // fft10_test_plan.c
+void    test_many(void);                    // fft10_test_many.c
+void    test_real(void);                    // fft10_test_real.c
+void    test_conv(void);                    // fft10_test_conv.c
+void    test_stft(void);                    // fft10_test_stft.c
+void    test_file(void);                    // fft10_test_file.c
+void    test_precision(void);               // fft10_test_precision.c
+void    test_wisdom(void);                  // fft10_test_wisdom.c
+void    test_nd(void);                      // fft10_test_nd.c
+void    test_bins(void);                    // fft10_test_bins.c
+
+#endif
@@ -0,0 +1,95 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_test_bins.c
+ * Description: Tests of fft10_bins_execute of every method on full and partial inputs
+ * against the bins of the direct DFT.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - move out of fft10_test.c
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "fft10_test.h"
+
+/* fft10_bins_execute of every method on full and on partial inputs */
+void test_bins(void) {
+    static const unsigned methods[4] = { 0u, FFT10_BINS_GOERTZEL, FFT10_BINS_PRUNED, FFT10_BINS_CHIRP };
+    static const char*    names[4]   = { "auto", "goertzel", "pruned", "chirp" };
+    static const size_t   sizes[]    = { 97, 1000, 4096 };
+    const size_t          count = 20;
+    size_t                bins[20];
+    char                  what[96];
+
+    for(size_t s = 0; s < sizeof(sizes)/sizeof(sizes[0]); s++)
+    {
+        size_t  n = sizes[s];
+        float*  x = xalloc(2*n*sizeof(float));
+        float*  X = xalloc(2*count*sizeof(float));
+        double* xd = xalloc(2*n*sizeof(double));
+        double* F = xalloc(2*n*sizeof(double));
+        double* R = xalloc(2*count*sizeof(double));
+
+        // full, a third of the signal, and fewer values than the pruned transform has columns
+        for(int partial = 0; partial < 3; partial++)
+        {
+            size_t first    = partial == 2 ? n - 9 : partial ? n/5 : 0;
+            size_t in_count = partial == 2 ? 7 : partial ? n/3 : n;
+
+            // the signal is zero outside first..first+in_count-1
+            fill_random(x, 2*n);
+            memset(xd, 0, 2*n*sizeof(double));
+            for(size_t j = 2*first; j < 2*(first + in_count); j++)
+            {
+                xd[j] = x[j];
+            }
+            for(int backward = 0; backward < 2; backward++)
+            {
+                direct_dft(xd, 1, F, 1, n, backward ? 1 : -1, backward ? 1.0/(double)n : 1.0);
+                for(int m = 0; m < 4; m++)
+                {
+                    unsigned    flags = methods[m] | (backward ? FFT10_BACKWARD : FFT10_ESTIMATE);
+                    fft10_bins* b;
+
+                    // consecutive bins across the wrap for the chirp, scattered ones for the others
+                    for(size_t i = 0; i < count; i++)
+                    {
+                        bins[i] = methods[m] == FFT10_BINS_CHIRP ? (n - count/2 + i) % n : (i*i*7 + i) % n;
+                        R[2*i]   = F[2*bins[i]];
+                        R[2*i+1] = F[2*bins[i]+1];
+                    }
+                    b = methods[m] == FFT10_BINS_CHIRP
+                        ? fft10_bins_create_range(n, n - count/2, count, first, in_count, flags)
+                        : fft10_bins_create(n, bins, count, first, in_count, flags);
+                    snprintf(what, sizeof(what), "bins %s%s n=%zu in=%zu..%zu", names[m],
+                             backward ? " backward" : "", n, first, first + in_count - 1);
+                    if(!b)
+                    {
+                        check(what, INFINITY, TEST_TOL_FLOAT);
+                        continue;
+                    }
+                    fft10_bins_execute(b, x + 2*first, X);
+                    check(what, rel_rms_f(X, R, 2*count), TEST_TOL_FLOAT);
+                    fft10_bins_destroy(b);
+                }
+            }
+        }
+        free(x);
+        free(X);
+        free(xd);
+        free(F);
+        free(R);
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_test_conv.c
+ * Description: Tests of fft10_conv_process of every method against the direct
+ * convolution of the stream, and of fft10_conv_reset.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - move out of fft10_test.c
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "fft10_test.h"
+
+/* fft10_conv_process of every method against the direct convolution of the stream */
+void test_conv(void) {
+    static const unsigned methods[4] = { FFT10_CONV_OVERLAP_SAVE, FFT10_CONV_OVERLAP_ADD,
+                                         FFT10_CONV_PARTITIONED, FFT10_CONV_OVERLAP_ADD | FFT10_CONV_PARTITIONED };
+    static const char*    names[4]   = { "overlap-save", "overlap-add", "partitioned", "partitioned overlap-add" };
+    static const size_t   taps[3]    = { 1, 37, 300 };
+    const size_t          block = 64, blocks = 12, len = block*blocks;
+    float*                x = xalloc(len*sizeof(float));
+    float*                y = xalloc(len*sizeof(float));
+    double*               r = xalloc(len*sizeof(double));
+    float                 h[300];
+    char                  what[96];
+
+    fill_random(x, len);
+    fill_random(h, 300);
+    for(size_t t = 0; t < 3; t++)
+    {
+        for(size_t j = 0; j < len; j++)
+        {
+            double acc = 0.0;
+
+            for(size_t k = 0; k < taps[t] && k <= j; k++)
+            {
+                acc += (double)h[k]*x[j-k];
+            }
+            r[j] = acc;
+        }
+        for(int m = 0; m < 4; m++)
+        {
+            fft10_conv* conv = fft10_conv_create(h, taps[t], block, methods[m]);
+
+            snprintf(what, sizeof(what), "conv %s taps=%zu block=%zu", names[m], taps[t], block);
+            if(!conv)
+            {
+                check(what, INFINITY, TEST_TOL_FLOAT);
+                continue;
+            }
+            for(size_t b = 0; b < blocks; b++)
+            {
+                fft10_conv_process(conv, x + b*block, y + b*block);
+            }
+            check(what, rel_rms_f(y, r, len), TEST_TOL_FLOAT);
+
+            // after a reset the stream starts over
+            fft10_conv_reset(conv);
+            memcpy(y, x, block*sizeof(float));
+            fft10_conv_process(conv, y, y);
+            snprintf(what, sizeof(what), "conv %s taps=%zu reset, in place", names[m], taps[t]);
+            check(what, rel_rms_f(y, r, block), TEST_TOL_FLOAT);
+            fft10_conv_destroy(conv);
+        }
+    }
+    free(x);
+    free(y);
+    free(r);
+}
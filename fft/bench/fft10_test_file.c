@@ -0,0 +1,116 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_test_file.c
+ * Description: Tests of fft10_execute_file in one piece and in passes limited by
+ * mem_bytes, and of the requests it refuses.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - move out of fft10_test.c
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * The input and output files are written to the current folder and removed
+ * afterwards.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "fft10_test.h"
+
+#define TEST_FILE_IN      "fft10_test_in.bin"
+#define TEST_FILE_OUT     "fft10_test_out.bin"
+
+/* fft10_execute_file in one piece and in passes limited by mem_bytes */
+void test_file(void) {
+    static const size_t sizes[] = { 10, 1000, 1001, 4096 };   // 1001 = 7*11*13 on Bluestein
+    static const size_t mems[]  = { 1u << 20, 20000, 2048 };
+    char                what[96];
+
+    for(size_t s = 0; s < sizeof(sizes)/sizeof(sizes[0]); s++)
+    {
+        size_t  n = sizes[s];
+        float*  x = xalloc(2*n*sizeof(float));
+        float*  X = xalloc(2*n*sizeof(float));
+        double* xd;
+        double* R = xalloc(2*n*sizeof(double));
+        double* B = xalloc(2*n*sizeof(double));
+        FILE*   f;
+
+        fill_random(x, 2*n);
+        xd = to_double(x, 2*n);
+        direct_dft(xd, 1, R, 1, n, -1, 1.0);
+        direct_dft(xd, 1, B, 1, n, 1, 1.0/(double)n);
+        f = fopen(TEST_FILE_IN, "wb");
+        if(!f || fwrite(x, sizeof(float), 2*n, f) != 2*n)
+        {
+            fprintf(stderr, "fft10_test: could not write %s\n", TEST_FILE_IN);
+            test_failures++;
+        }
+        if(f)
+        {
+            fclose(f);
+        }
+        for(size_t m = 0; m < sizeof(mems)/sizeof(mems[0]); m++)
+        {
+            for(int backward = 0; backward < 2; backward++)
+            {
+                int ret = fft10_execute_file(TEST_FILE_IN, TEST_FILE_OUT,
+                                             backward ? FFT10_BACKWARD : FFT10_ESTIMATE, mems[m]);
+                double err = INFINITY;
+
+                f = ret == 0 ? fopen(TEST_FILE_OUT, "rb") : NULL;
+                if(f)
+                {
+                    if(fread(X, sizeof(float), 2*n, f) == 2*n)
+                    {
+                        err = rel_rms_f(X, backward ? B : R, 2*n);
+                    }
+                    fclose(f);
+                }
+                snprintf(what, sizeof(what), "execute_file%s n=%zu mem_bytes=%zu",
+                         backward ? " backward" : "", n, mems[m]);
+                check(what, err, TEST_TOL_FLOAT);
+            }
+        }
+        remove(TEST_FILE_IN);
+        remove(TEST_FILE_OUT);
+        free(x);
+        free(X);
+        free(xd);
+        free(R);
+        free(B);
+    }
+
+    // real and precision flags are rejected
+    check("execute_file rejects FFT10_REAL",
+          fft10_execute_file(TEST_FILE_IN, TEST_FILE_OUT, FFT10_REAL, 1u << 20) == -1 ? 0.0 : 1.0, 0.0);
+
+    // 1009 points fit into 20000 bytes, the Bluestein scratch of the prime length does not
+    {
+        float* x = xalloc(2*1009*sizeof(float));
+        FILE*  f = fopen(TEST_FILE_IN, "wb");
+        fill_random(x, 2*1009);
+        if(f)
+        {
+            fwrite(x, sizeof(float), 2*1009, f);
+            fclose(f);
+        }
+        check("execute_file rejects n=1009 mem_bytes=20000",
+              fft10_execute_file(TEST_FILE_IN, TEST_FILE_OUT, FFT10_ESTIMATE, 20000) == -1 ? 0.0 : 1.0, 0.0);
+        remove(TEST_FILE_IN);
+        remove(TEST_FILE_OUT);
+        free(x);
+    }
+}
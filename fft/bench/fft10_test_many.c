@@ -0,0 +1,85 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_test_many.c
+ * Description: Tests of fft10_execute_many on contiguous and interleaved batches, and
+ * of the plans it refuses.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - move out of fft10_test.c
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "fft10_test.h"
+
+/* fft10_execute_many on contiguous and on interleaved transforms, every transform checked */
+void test_many(void) {
+    static const size_t sizes[] = { 1, 7, 10, 100, 210, 1000 };
+    const size_t        howmany = 5;
+    char                what[96];
+
+    for(size_t s = 0; s < sizeof(sizes)/sizeof(sizes[0]); s++)
+    {
+        size_t      n = sizes[s];
+        float*      x = xalloc(2*n*howmany*sizeof(float));
+        float*      X = xalloc(2*n*howmany*sizeof(float));
+        double*     xd;
+        double*     R = xalloc(2*n*howmany*sizeof(double));
+        fft10_plan* plan = fft10_plan_create(n, FFT10_ESTIMATE);
+
+        fill_random(x, 2*n*howmany);
+        xd = to_double(x, 2*n*howmany);
+        if(plan)
+        {
+            // transform b at b*n, the points one after the other
+            for(size_t b = 0; b < howmany; b++)
+            {
+                direct_dft(xd + 2*b*n, 1, R + 2*b*n, 1, n, -1, 1.0);
+            }
+            fft10_execute_many(plan, howmany, x, 1, n, X, 1, n);
+            snprintf(what, sizeof(what), "execute_many n=%zu howmany=%zu", n, howmany);
+            check(what, rel_rms_f(X, R, 2*n*howmany), TEST_TOL_FLOAT);
+
+            // transform b at b, its points howmany apart
+            for(size_t b = 0; b < howmany; b++)
+            {
+                direct_dft(xd + 2*b, howmany, R + 2*b, howmany, n, -1, 1.0);
+            }
+            fft10_execute_many(plan, howmany, x, howmany, 1, X, howmany, 1);
+            snprintf(what, sizeof(what), "execute_many interleaved n=%zu howmany=%zu", n, howmany);
+            check(what, rel_rms_f(X, R, 2*n*howmany), TEST_TOL_FLOAT);
+        }
+        else
+        {
+            snprintf(what, sizeof(what), "execute_many n=%zu", n);
+            check(what, INFINITY, TEST_TOL_FLOAT);
+        }
+        fft10_plan_destroy(plan);
+        free(x);
+        free(X);
+        free(xd);
+        free(R);
+    }
+
+    // real and double plans are not batched
+    {
+        fft10_plan* real = fft10_plan_create(10, FFT10_REAL);
+        fft10_plan* pd   = fft10_plan_create(10, FFT10_DOUBLE);
+        float       x[20] = {0}, X[20];
+        check("execute_many rejects FFT10_REAL", fft10_execute_many(real, 1, x, 1, 10, X, 1, 10) == -1 ? 0.0 : 1.0, 0.0);
+        check("execute_many rejects FFT10_DOUBLE", fft10_execute_many(pd, 1, x, 1, 10, X, 1, 10) == -1 ? 0.0 : 1.0, 0.0);
+        fft10_plan_destroy(real);
+        fft10_plan_destroy(pd);
+    }
+}
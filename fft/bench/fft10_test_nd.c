@@ -0,0 +1,122 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_test_nd.c
+ * Description: Tests of fft10_nd_execute forward and backward, fft10_nd_execute_r2c
+ * and fft10_nd_execute_c2r against the direct transform axis by axis.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - move out of fft10_test.c
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "fft10_test.h"
+
+/* fft10_nd_execute forward and backward, fft10_nd_execute_r2c and fft10_nd_execute_c2r */
+void test_nd(void) {
+    static const size_t shapes[][3] = { { 6, 10, 0 }, { 1, 7, 0 }, { 16, 25, 0 }, { 5, 4, 6 }, { 3, 10, 7 } };
+    static const int    ranks[]     = { 2, 2, 2, 3, 3 };
+    char                what[96];
+
+    for(size_t s = 0; s < sizeof(ranks)/sizeof(ranks[0]); s++)
+    {
+        int         rank = ranks[s];
+        const size_t* dims = shapes[s];
+        size_t      total = 1, last = dims[rank-1], hl = last/2 + 1, htotal;
+        float*      x;
+        float*      X;
+        double*     R;
+        double*     B;
+        double*     Rh;
+        float*      Rf;
+        fft10_nd*   fwd = fft10_nd_create(rank, dims, FFT10_ESTIMATE);
+        fft10_nd*   bwd = fft10_nd_create(rank, dims, FFT10_BACKWARD);
+        fft10_nd*   real = fft10_nd_create(rank, dims, FFT10_REAL);
+
+        for(int d = 0; d < rank; d++)
+        {
+            total *= dims[d];
+        }
+        htotal = total/last*hl;
+        x  = xalloc(2*total*sizeof(float));
+        X  = xalloc(2*total*sizeof(float));
+        Rh = xalloc(2*htotal*sizeof(double));
+        Rf = xalloc(2*htotal*sizeof(float));
+        fill_random(x, 2*total);
+        R = to_double(x, 2*total);
+        B = to_double(x, 2*total);
+        direct_nd(R, rank, dims, -1, 1.0);
+        direct_nd(B, rank, dims, 1, 1.0/(double)total);
+
+        snprintf(what, sizeof(what), "nd_execute rank=%d n=%zux%zux%zu", rank, dims[0], dims[1], dims[2]);
+        if(fwd && bwd)
+        {
+            fft10_nd_execute(fwd, x, X);
+            check(what, rel_rms_f(X, R, 2*total), TEST_TOL_FLOAT);
+            snprintf(what, sizeof(what), "nd_execute backward rank=%d n=%zux%zux%zu", rank, dims[0], dims[1],
+                     dims[2]);
+            memcpy(X, x, 2*total*sizeof(float));
+            fft10_nd_execute(bwd, X, X);
+            check(what, rel_rms_f(X, B, 2*total), TEST_TOL_FLOAT);
+        }
+        else
+        {
+            check(what, INFINITY, TEST_TOL_FLOAT);
+        }
+
+        // the real input is x[0..total), the reference its full complex transform cut to hl bins per row
+        free(R);
+        R = xalloc(2*total*sizeof(double));
+        for(size_t j = 0; j < total; j++)
+        {
+            R[2*j]   = x[j];
+            R[2*j+1] = 0.0;
+        }
+        direct_nd(R, rank, dims, -1, 1.0);
+        for(size_t row = 0; row < total/last; row++)
+        {
+            memcpy(Rh + 2*row*hl, R + 2*row*last, 2*hl*sizeof(double));
+        }
+        for(size_t k = 0; k < 2*htotal; k++)
+        {
+            Rf[k] = (float)Rh[k];
+        }
+        snprintf(what, sizeof(what), "nd_execute_r2c rank=%d n=%zux%zux%zu", rank, dims[0], dims[1], dims[2]);
+        if(real)
+        {
+            double* xr = to_double(x, total);
+
+            fft10_nd_execute_r2c(real, x, X);
+            check(what, rel_rms_f(X, Rh, 2*htotal), TEST_TOL_FLOAT);
+            snprintf(what, sizeof(what), "nd_execute_c2r rank=%d n=%zux%zux%zu", rank, dims[0], dims[1], dims[2]);
+            fft10_nd_execute_c2r(real, Rf, X);
+            check(what, rel_rms_f(X, xr, total), TEST_TOL_FLOAT);
+            free(xr);
+        }
+        else
+        {
+            check(what, INFINITY, TEST_TOL_FLOAT);
+        }
+        fft10_nd_destroy(fwd);
+        fft10_nd_destroy(bwd);
+        fft10_nd_destroy(real);
+        free(x);
+        free(X);
+        free(R);
+        free(B);
+        free(Rh);
+        free(Rf);
+    }
+}
@@ -0,0 +1,76 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_test_plan.c
+ * Description: Tests of fft10_plan_create and fft10_execute: the estimated, recursive
+ * and iterative plans forward and backward, run by main with every
+ * instruction set the cpu supports and with 1 and 4 threads.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - move out of fft10_test.c
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "fft10_test.h"
+
+static const size_t test_sizes[] = { 1, 2, 3, 7, 10, 16, 30, 97, 100, 210, 512, 1000, 1024, 2000, 10000 };
+#define TEST_NSIZES  (sizeof(test_sizes)/sizeof(test_sizes[0]))
+
+/* fft10_execute forward and backward on the planner variants */
+void test_plans(const char* tag) {
+    static const unsigned variants[3] = { FFT10_ESTIMATE, FFT10_RECURSIVE, FFT10_ITERATIVE };
+    static const char*    names[3]    = { "", " recursive", " iterative" };
+    char                  what[96];
+
+    for(size_t s = 0; s < TEST_NSIZES; s++)
+    {
+        size_t  n = test_sizes[s];
+        float*  x = xalloc(2*n*sizeof(float));
+        float*  X = xalloc(2*n*sizeof(float));
+        double* xd;
+        double* R = xalloc(2*n*sizeof(double));
+        double* B = xalloc(2*n*sizeof(double));
+
+        fill_random(x, 2*n);
+        xd = to_double(x, 2*n);
+        direct_dft(xd, 1, R, 1, n, -1, 1.0);
+        direct_dft(xd, 1, B, 1, n, 1, 1.0/(double)n);
+        for(int v = 0; v < 3; v++)
+        {
+            fft10_plan* fwd = fft10_plan_create(n, variants[v]);
+            fft10_plan* bwd = fft10_plan_create(n, variants[v] | FFT10_BACKWARD);
+
+            snprintf(what, sizeof(what), "execute%s n=%zu %s", names[v], n, tag);
+            if(!fwd || !bwd)
+            {
+                check(what, INFINITY, TEST_TOL_FLOAT);
+            }
+            else
+            {
+                fft10_execute(fwd, x, X);
+                check(what, rel_rms_f(X, R, 2*n), TEST_TOL_FLOAT);
+                snprintf(what, sizeof(what), "execute%s backward n=%zu %s", names[v], n, tag);
+                fft10_execute(bwd, x, X);
+                check(what, rel_rms_f(X, B, 2*n), TEST_TOL_FLOAT);
+            }
+            fft10_plan_destroy(fwd);
+            fft10_plan_destroy(bwd);
+        }
+        free(x);
+        free(X);
+        free(xd);
+        free(R);
+        free(B);
+    }
+}
@@ -0,0 +1,125 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_test_precision.c
+ * Description: Tests of fft10_execute_d, fft10_execute_q15 and fft10_execute_q31
+ * against the DFT of their (rounded) input, and of the plans they refuse.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - move out of fft10_test.c
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <stdint.h>
+#include "fft10_test.h"
+
+/* fft10_execute_d, fft10_execute_q15 and fft10_execute_q31 against the DFT of their (rounded) input */
+void test_precision(void) {
+    static const size_t sizes[] = { 1, 2, 10, 30, 100, 1000, 1024 };   // 2^a*3^b*5^c only
+    char                what[96];
+
+    for(size_t s = 0; s < sizeof(sizes)/sizeof(sizes[0]); s++)
+    {
+        size_t      n = sizes[s];
+        float*      x = xalloc(2*n*sizeof(float));
+        double*     xd = xalloc(2*n*sizeof(double));
+        double*     Xd = xalloc(2*n*sizeof(double));
+        double*     R = xalloc(2*n*sizeof(double));
+        int16_t*    q15 = xalloc(2*n*sizeof(int16_t));
+        int32_t*    q31 = xalloc(2*n*sizeof(int32_t));
+        fft10_plan* pd = fft10_plan_create(n, FFT10_DOUBLE);
+        fft10_plan* p15 = fft10_plan_create(n, FFT10_Q15);
+        fft10_plan* p31 = fft10_plan_create(n, FFT10_Q31);
+        int         e;
+
+        fill_random(x, 2*n);
+        snprintf(what, sizeof(what), "execute_d n=%zu", n);
+        if(pd)
+        {
+            for(size_t j = 0; j < 2*n; j++)
+            {
+                xd[j] = x[j] + 1e-3*(double)rand()/RAND_MAX;    // more than float precision
+            }
+            direct_dft(xd, 1, R, 1, n, -1, 1.0);
+            fft10_execute_d(pd, xd, Xd);
+            check(what, rel_rms(Xd, R, 2*n), TEST_TOL_DOUBLE);
+        }
+        else
+        {
+            check(what, INFINITY, TEST_TOL_DOUBLE);
+        }
+
+        snprintf(what, sizeof(what), "execute_q15 n=%zu", n);
+        if(p15)
+        {
+            for(size_t j = 0; j < 2*n; j++)
+            {
+                q15[j] = (int16_t)lrint(ldexp(x[j], 15));
+                xd[j]  = ldexp(q15[j], -15);
+            }
+            direct_dft(xd, 1, R, 1, n, -1, 1.0);
+            e = fft10_execute_q15(p15, q15, q15);
+            for(size_t j = 0; j < 2*n; j++)
+            {
+                Xd[j] = ldexp(q15[j], e - 15);
+            }
+            check(what, rel_rms(Xd, R, 2*n), TEST_TOL_Q15);
+        }
+        else
+        {
+            check(what, INFINITY, TEST_TOL_Q15);
+        }
+
+        snprintf(what, sizeof(what), "execute_q31 n=%zu", n);
+        if(p31)
+        {
+            for(size_t j = 0; j < 2*n; j++)
+            {
+                q31[j] = (int32_t)lrint(ldexp(x[j], 31));
+                xd[j]  = ldexp(q31[j], -31);
+            }
+            direct_dft(xd, 1, R, 1, n, -1, 1.0);
+            e = fft10_execute_q31(p31, q31, q31);
+            for(size_t j = 0; j < 2*n; j++)
+            {
+                Xd[j] = ldexp(q31[j], e - 31);
+            }
+            check(what, rel_rms(Xd, R, 2*n), TEST_TOL_Q31);
+        }
+        else
+        {
+            check(what, INFINITY, TEST_TOL_Q31);
+        }
+        fft10_plan_destroy(pd);
+        fft10_plan_destroy(p15);
+        fft10_plan_destroy(p31);
+        free(x);
+        free(xd);
+        free(Xd);
+        free(R);
+        free(q15);
+        free(q31);
+    }
+
+    // lengths with other prime factors have no double or fixed point plans
+    check("plan_create rejects FFT10_DOUBLE n=7", fft10_plan_create(7, FFT10_DOUBLE) ? 1.0 : 0.0, 0.0);
+
+    // float transforms are refused on fixed point plans
+    {
+        fft10_plan* p15 = fft10_plan_create(10, FFT10_Q15);
+        float       x[20] = {0}, X[20];
+        check("execute rejects FFT10_Q15", fft10_execute(p15, x, X) == -1 ? 0.0 : 1.0, 0.0);
+        fft10_plan_destroy(p15);
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_test_real.c
+ * Description: Tests of fft10_execute_r2c and fft10_execute_c2r against the bins
+ * 0..n/2 of the direct DFT.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - move out of fft10_test.c
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "fft10_test.h"
+
+/* fft10_execute_r2c against the bins 0..n/2 of the DFT, fft10_execute_c2r of these bins back to x */
+void test_real(void) {
+    static const size_t sizes[] = { 1, 2, 3, 7, 10, 15, 16, 100, 210, 1000, 1001 };
+    char                what[96];
+
+    for(size_t s = 0; s < sizeof(sizes)/sizeof(sizes[0]); s++)
+    {
+        size_t      n = sizes[s], h = n/2 + 1;
+        float*      x = xalloc(n*sizeof(float));
+        float*      X = xalloc(2*h*sizeof(float));
+        float*      y = xalloc(n*sizeof(float));
+        double*     xc = xalloc(2*n*sizeof(double));
+        double*     xd;
+        double*     R = xalloc(2*n*sizeof(double));
+        float*      Rf = xalloc(2*h*sizeof(float));
+        fft10_plan* plan = fft10_plan_create(n, FFT10_REAL);
+
+        fill_random(x, n);
+        xd = to_double(x, n);
+        for(size_t j = 0; j < n; j++)
+        {
+            xc[2*j]   = x[j];
+            xc[2*j+1] = 0.0;
+        }
+        direct_dft(xc, 1, R, 1, n, -1, 1.0);
+        for(size_t k = 0; k < 2*h; k++)
+        {
+            Rf[k] = (float)R[k];
+        }
+        if(plan)
+        {
+            fft10_execute_r2c(plan, x, X);
+            snprintf(what, sizeof(what), "execute_r2c n=%zu", n);
+            check(what, rel_rms_f(X, R, 2*h), TEST_TOL_FLOAT);
+            fft10_execute_c2r(plan, Rf, y);
+            snprintf(what, sizeof(what), "execute_c2r n=%zu", n);
+            check(what, rel_rms_f(y, xd, n), TEST_TOL_FLOAT);
+        }
+        else
+        {
+            snprintf(what, sizeof(what), "execute_r2c n=%zu", n);
+            check(what, INFINITY, TEST_TOL_FLOAT);
+        }
+        fft10_plan_destroy(plan);
+        free(x);
+        free(X);
+        free(y);
+        free(xc);
+        free(xd);
+        free(R);
+        free(Rf);
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_test_stft.c
+ * Description: Tests of fft10_stft_push of every output type against the DFT of the
+ * windowed frames, and of fft10_istft_push back to the signal.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - move out of fft10_test.c
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "fft10_test.h"
+
+/* fft10_stft_push of every output type against the DFT of the windowed frames, fft10_istft_push back */
+void test_stft(void) {
+    const size_t nfft = 64, win_len = 48, hop = 16, h = nfft/2 + 1, len = 1000, chunk = 37;
+    const size_t nframes = (len - win_len)/hop + 1;
+    float*       x = xalloc(len*sizeof(float));
+    float*       w = xalloc(win_len*sizeof(float));
+    float*       frames = xalloc((nframes + 1)*2*h*sizeof(float));
+    float*       y = xalloc((nframes + 1)*hop*sizeof(float));
+    double*      R = xalloc(nframes*2*h*sizeof(double));
+    double*      P = xalloc(nframes*h*sizeof(double));
+    double*      xd;
+    double       frame[2*64], X[2*64];
+    char         what[96];
+
+    fill_random(x, len);
+    xd = to_double(x, len);
+    fft10_window(FFT10_WINDOW_HANN, w, win_len);
+    for(size_t t = 0; t < nframes; t++)
+    {
+        memset(frame, 0, sizeof(frame));
+        for(size_t j = 0; j < win_len; j++)
+        {
+            frame[2*j] = (double)w[j]*x[t*hop + j];
+        }
+        direct_dft(frame, 1, X, 1, nfft, -1, 1.0);
+        memcpy(R + t*2*h, X, 2*h*sizeof(double));
+    }
+
+    for(int output = FFT10_STFT_COMPLEX; output <= FFT10_STFT_POWER; output++)
+    {
+        static const char* names[3] = { "complex", "magnitude", "power" };
+        fft10_stft*        st = fft10_stft_create(nfft, win_len, hop, w, output);
+        size_t             per = output == FFT10_STFT_COMPLEX ? 2*h : h, got = 0;
+
+        snprintf(what, sizeof(what), "stft %s nfft=%zu win_len=%zu hop=%zu", names[output], nfft, win_len, hop);
+        if(!st)
+        {
+            check(what, INFINITY, TEST_TOL_FLOAT);
+            continue;
+        }
+        for(size_t j = 0; j < len; j += chunk)
+        {
+            got += fft10_stft_push(st, x + j, j + chunk <= len ? chunk : len - j, frames + got*per);
+        }
+        for(size_t k = 0; output != FFT10_STFT_COMPLEX && k < nframes*h; k++)
+        {
+            double p = R[2*k]*R[2*k] + R[2*k+1]*R[2*k+1];
+
+            P[k] = output == FFT10_STFT_POWER ? p : sqrt(p);
+        }
+        check(what, got == nframes ? rel_rms_f(frames, output == FFT10_STFT_COMPLEX ? R : P, nframes*per)
+                                   : INFINITY, TEST_TOL_FLOAT);
+        if(output == FFT10_STFT_COMPLEX)
+        {
+            fft10_istft* is = fft10_istft_create(nfft, win_len, hop, w);
+            size_t       out = 0;
+
+            // every sample from win_len on is covered by win_len/hop frames
+            snprintf(what, sizeof(what), "istft nfft=%zu win_len=%zu hop=%zu", nfft, win_len, hop);
+            for(size_t t = 0; is && t < nframes; t += 5)
+            {
+                out += fft10_istft_push(is, frames + t*2*h, t + 5 <= nframes ? 5 : nframes - t, y + out);
+            }
+            check(what, is && out == nframes*hop ? rel_rms_f(y + win_len, xd + win_len, out - win_len)
+                                                 : INFINITY, TEST_TOL_FLOAT);
+            fft10_istft_destroy(is);
+        }
+        fft10_stft_destroy(st);
+    }
+    free(x);
+    free(w);
+    free(frames);
+    free(y);
+    free(R);
+    free(P);
+    free(xd);
+}
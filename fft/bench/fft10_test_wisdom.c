@@ -0,0 +1,78 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_test_wisdom.c
+ * Description: Tests of FFT10_MEASURE plans and of plans built from exported and
+ * imported wisdom.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - move out of fft10_test.c
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * The wisdom file is written to the current folder and removed afterwards.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "fft10_test.h"
+
+#define TEST_FILE_WISDOM  "fft10_test.wisdom"
+
+/* FFT10_MEASURE plans, and plans built from exported and imported wisdom */
+void test_wisdom(void) {
+    static const size_t sizes[] = { 100, 1000, 2000 };
+    char                what[96];
+
+    for(int pass = 0; pass < 2; pass++)
+    {
+        for(size_t s = 0; s < sizeof(sizes)/sizeof(sizes[0]); s++)
+        {
+            size_t      n = sizes[s];
+            float*      x = xalloc(2*n*sizeof(float));
+            float*      X = xalloc(2*n*sizeof(float));
+            double*     xd;
+            double*     R = xalloc(2*n*sizeof(double));
+            fft10_plan* plan = fft10_plan_create(n, FFT10_MEASURE | FFT10_NO_CACHE);
+
+            fill_random(x, 2*n);
+            xd = to_double(x, 2*n);
+            direct_dft(xd, 1, R, 1, n, -1, 1.0);
+            snprintf(what, sizeof(what), "execute %s n=%zu", pass ? "imported wisdom" : "measure", n);
+            if(plan)
+            {
+                fft10_execute(plan, x, X);
+                check(what, rel_rms_f(X, R, 2*n), TEST_TOL_FLOAT);
+            }
+            else
+            {
+                check(what, INFINITY, TEST_TOL_FLOAT);
+            }
+            fft10_plan_destroy(plan);
+            free(x);
+            free(X);
+            free(xd);
+            free(R);
+        }
+        if(pass == 0)
+        {
+            int ok = fft10_wisdom_export(TEST_FILE_WISDOM) == 0;
+
+            fft10_wisdom_forget();
+            ok = ok && fft10_wisdom_import(TEST_FILE_WISDOM) == 0;
+            check("wisdom export, forget and import", ok ? 0.0 : 1.0, 0.0);
+            remove(TEST_FILE_WISDOM);
+        }
+    }
+}
@@ -1,6 +1,153 @@
 #ifndef __FFT10__H__
 #define __FFT10__H__
 
+#include <stddef.h>
+#include <stdint.h>
+
 void local_fft_radix10(int read_from, int read_jump, int write_to, int lgth, float* x_in, float* X_out);
 
-#endif
\ No newline at end of file
+// plan based interface, see fft10_plan.c
+typedef struct fft10_plan fft10_plan;
+
+#define FFT10_ESTIMATE   0u
+#define FFT10_NO_CACHE   (1u << 0)
+#define FFT10_RECURSIVE  (1u << 1)
+#define FFT10_ITERATIVE  (1u << 2)
+#define FFT10_REAL       (1u << 3)
+#define FFT10_BACKWARD   (1u << 4)
+#define FFT10_DOUBLE     (1u << 5)
+#define FFT10_Q15        (1u << 6)
+#define FFT10_Q31        (1u << 7)
+#define FFT10_MEASURE    (1u << 8)
+
+fft10_plan* fft10_plan_create(size_t n, unsigned flags);
+int         fft10_execute(const fft10_plan* plan, const float* in, float* out);
+void        fft10_plan_destroy(fft10_plan* plan);
+void        fft10_cleanup(void);
+
+// decisions of FFT10_MEASURE ("wisdom") kept across runs, see fft10_tune.c
+int         fft10_wisdom_export(const char* path);
+int         fft10_wisdom_import(const char* path);
+void        fft10_wisdom_forget(void);
+
+// transforms of real signals on FFT10_REAL plans, see fft10_real.c
+void        fft10_execute_r2c(const fft10_plan* plan, const float* in, float* out);
+void        fft10_execute_c2r(const fft10_plan* plan, const float* in, float* out);
+
+// double precision and fixed point transforms, see fft10_precision.c
+void        fft10_execute_d(const fft10_plan* plan, const double* in, double* out);
+int         fft10_execute_q15(const fft10_plan* plan, const int16_t* in, int16_t* out);
+int         fft10_execute_q31(const fft10_plan* plan, const int32_t* in, int32_t* out);
+
+// many transforms of one length, see fft10_batch.c
+int         fft10_execute_many(const fft10_plan* plan, size_t howmany,
+                               const float* in, size_t istride, size_t idist,
+                               float* out, size_t ostride, size_t odist);
+
+// out-of-core transform of memory mapped files, see fft10_file.c
+int         fft10_execute_file(const char* in_path, const char* out_path, unsigned flags, size_t mem_bytes);
+
+// 2D/3D transforms of row-major arrays, see fft10_nd.c
+typedef struct fft10_nd fft10_nd;
+
+#define FFT10_ND_MAX_RANK  3
+
+fft10_nd*   fft10_nd_create(int rank, const size_t* dims, unsigned flags);
+void        fft10_nd_execute(const fft10_nd* nd, const float* in, float* out);
+void        fft10_nd_execute_r2c(const fft10_nd* nd, const float* in, float* out);
+void        fft10_nd_execute_c2r(const fft10_nd* nd, const float* in, float* out);
+void        fft10_nd_destroy(fft10_nd* nd);
+
+// selected output bins of a transform, see fft10_bins.c
+typedef struct fft10_bins fft10_bins;
+
+#define FFT10_BINS_GOERTZEL  (1u << 12)
+#define FFT10_BINS_PRUNED    (1u << 13)
+#define FFT10_BINS_CHIRP     (1u << 14)
+
+fft10_bins* fft10_bins_create(size_t n, const size_t* bins, size_t count, size_t in_first, size_t in_count,
+                              unsigned flags);
+fft10_bins* fft10_bins_create_range(size_t n, size_t k0, size_t count, size_t in_first, size_t in_count,
+                                    unsigned flags);
+unsigned    fft10_bins_method(const fft10_bins* b);
+void        fft10_bins_execute(const fft10_bins* b, const float* in, float* out);
+void        fft10_bins_destroy(fft10_bins* b);
+
+// streaming fft convolution with a real FIR filter, see fft10_conv.c
+typedef struct fft10_conv fft10_conv;
+
+#define FFT10_CONV_OVERLAP_SAVE  0u
+#define FFT10_CONV_OVERLAP_ADD   (1u << 0)
+#define FFT10_CONV_PARTITIONED   (1u << 1)
+
+fft10_conv* fft10_conv_create(const float* h, size_t taps, size_t block, unsigned flags);
+void        fft10_conv_process(fft10_conv* conv, const float* in, float* out);
+void        fft10_conv_reset(fft10_conv* conv);
+void        fft10_conv_destroy(fft10_conv* conv);
+
+// streaming short-time transforms of a real signal, see fft10_stft.c
+typedef struct fft10_stft fft10_stft;
+typedef struct fft10_istft fft10_istft;
+
+#define FFT10_WINDOW_RECT      0
+#define FFT10_WINDOW_HANN      1
+#define FFT10_WINDOW_HAMMING   2
+#define FFT10_WINDOW_BLACKMAN  3
+
+#define FFT10_STFT_COMPLEX     0
+#define FFT10_STFT_MAGNITUDE   1
+#define FFT10_STFT_POWER       2
+
+void         fft10_window(int type, float* w, size_t len);
+fft10_stft*  fft10_stft_create(size_t nfft, size_t win_len, size_t hop, const float* window, int output);
+size_t       fft10_stft_push(fft10_stft* st, const float* in, size_t count, float* frames);
+void         fft10_stft_reset(fft10_stft* st);
+void         fft10_stft_destroy(fft10_stft* st);
+fft10_istft* fft10_istft_create(size_t nfft, size_t win_len, size_t hop, const float* window);
+size_t       fft10_istft_push(fft10_istft* is, const float* frames, size_t nframes, float* out);
+void         fft10_istft_reset(fft10_istft* is);
+void         fft10_istft_destroy(fft10_istft* is);
+
+// opt-in instrumentation, recorded only if compiled with FFT10_PROFILE, see fft10_profile.c
+#define FFT10_PROFILE_EXECUTE  0   // fft10_execute calls, inclusive
+#define FFT10_PROFILE_PERMUTE  1   // digit reversal of the iterative engine
+#define FFT10_PROFILE_LEAF     2   // leaf DFTs, by radix
+#define FFT10_PROFILE_CODELET  3   // codelets, by number of radix 10 stages
+#define FFT10_PROFILE_PASS     4   // combine passes, by radix
+#define FFT10_PROFILE_STAGE    5   // combine passes, by stage
+#define FFT10_PROFILE_BATCH    6   // stages of fft10_execute_many batches, by radix
+#define FFT10_PROFILE_TWIDDLE  7   // twiddle tables of new plans
+#define FFT10_PROFILE_KINDS    8
+#define FFT10_PROFILE_SLOTS    64  // indices per kind
+
+#define FFT10_PROFILE_TIME     (1u << 0)
+#define FFT10_PROFILE_HW       (1u << 1)
+
+typedef struct {
+    unsigned long long calls;
+    unsigned long long ns;
+    unsigned long long bytes;
+    unsigned long long cycles;          // hardware counters, 0 without FFT10_PROFILE_HW
+    unsigned long long instructions;
+    unsigned long long cache_misses;
+} fft10_profile_counter;
+
+unsigned    fft10_profile_enable(unsigned what);
+void        fft10_profile_reset(void);
+int         fft10_profile_get(int kind, int index, fft10_profile_counter* counter);
+int         fft10_profile_dump(const char* path);
+
+// instruction set of the butterfly kernels, see fft10_kernels.c
+#define FFT10_ISA_SCALAR  0
+#define FFT10_ISA_SSE2    1
+#define FFT10_ISA_AVX2    2
+#define FFT10_ISA_AVX512  3
+
+int         fft10_get_isa(void);
+int         fft10_set_isa(int isa);
+
+// threads used by transforms, see fft10_threads.c
+int         fft10_set_threads(int nthreads);
+int         fft10_get_threads(void);
+
+#endif
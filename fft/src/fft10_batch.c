@@ -0,0 +1,248 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_batch.c
+ * Description: Batched interface for many transforms of the same length. Short
+ * transforms are vectorized across the batch: the transforms of one group are
+ * gathered side by side into a scratch block, one vector lane per transform,
+ * and all stages run on that block with twiddles broadcast from the table of
+ * the plan.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - add fft10_execute_many
+ * 18.10.2026 - scale of backward plans
+ * 18.10.2026 - codelet stages run on blocks of the lanes while they are in L1,
+ *              plans of a single long codelet run codelet by codelet
+ * 18.10.2026 - fft10_execute_many returns -1 on plans it does not batch
+ *
+ * ----------------------------------------------------------------------------
+ * Usage:
+ * ----------------------------------------------------------------------------
+ *     // 64 channels of 100 points, channel c starts at x + 2*100*c
+ *     fft10_plan* p = fft10_plan_create(100, FFT10_ESTIMATE);
+ *     fft10_execute_many(p, 64, x, 1, 100, X, 1, 100);
+ *     fft10_plan_destroy(p);
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * The groups of a batch are handed to the thread pool in chunks of a multiple
+ * of FFT10_KALIGN transforms, so which transforms share a vector (and the
+ * rounding of the result) does not depend on the number of threads.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "fft10_internal.h"
+
+typedef struct {
+    const fft10_plan*  plan;
+    size_t             howmany;
+    const float*       in;
+    size_t             istride;
+    size_t             idist;
+    float*             out;
+    size_t             ostride;
+    size_t             odist;
+    size_t             chunk;
+} batch_args;
+
+/* one complex value, copied as a whole */
+static inline void copy_complex(float* dst, const float* src) {
+    memcpy(dst, src, 2*sizeof(float));
+}
+
+/*
+ * transforms b0..b1-1, lanes of the widest kernel first, the rest on narrower
+ * ones. The codelet stages of the plan (the leading radix 10 stages) run on
+ * each block of their span as soon as it is gathered, while it is in L1; the
+ * remaining stages run on the whole group.
+ */
+static void batch_simd(const batch_args* a, size_t b0, size_t b1, float* buf) {
+    const fft10_plan* plan    = a->plan;
+    size_t            n       = plan->n;
+    size_t            istride = a->istride, idist = a->idist;
+    size_t            ostride = a->ostride, odist = a->odist;
+    size_t            b       = b0;
+
+    for(int isa = fft10_get_isa(); isa >= FFT10_ISA_SCALAR; isa--)
+    {
+        size_t w    = fft10_batch_width(isa);
+        int    c    = plan->codelet;
+        size_t leaf;
+
+        while(c > 0 && 2*plan->span[c-1]*w*sizeof(float) > FFT10_BATCH_LEAF_BYTES)
+        {
+            c--;
+        }
+        leaf = c > 0 ? plan->span[c-1] : n;
+
+        for(; b + w <= b1; b += w)
+        {
+            for(size_t i0 = 0; i0 < n; i0 += leaf)
+            {
+                fft10_batch_gather(plan, isa, a->in + 2*(b*idist), istride, idist, buf, i0, i0 + leaf);
+
+                if(plan->scale != 1.0f)
+                {
+                    for(size_t i = 2*i0*w; i < 2*(i0 + leaf)*w; i++)
+                    {
+                        buf[i] *= plan->scale;
+                    }
+                }
+                fft10_batch_stages(plan, isa, buf + 2*i0*w, leaf, 0, c);
+            }
+            fft10_batch_stages(plan, isa, buf, n, c, plan->nstages);
+
+            for(size_t l = 0; l < w; l++)
+            {
+                float* dst = a->out + 2*((b+l)*odist);
+                for(size_t i = 0; i < n; i++)
+                {
+                    copy_complex(dst + 2*i*ostride, buf + 2*(i*w + l));
+                }
+            }
+        }
+    }
+}
+
+/* transforms b0..b1-1 one after the other, for lengths too long to run side by side */
+static void batch_single(const batch_args* a, size_t b0, size_t b1, float* buf) {
+    const fft10_plan* plan = a->plan;
+
+    for(size_t b = b0; b < b1; b++)
+    {
+        const float* src = a->in  + 2*b*a->idist;
+        float*       dst = a->out + 2*b*a->odist;
+        if(a->istride == 1 && a->ostride == 1)
+        {
+            fft10_execute(plan, src, dst);
+        }
+        else if(a->ostride == 1 && src != dst)
+        {
+            fft10_execute_strided(plan, src, a->istride, dst);
+        }
+        else
+        {
+            fft10_execute_strided(plan, src, a->istride, buf);
+            for(size_t i = 0; i < plan->n; i++)
+            {
+                dst[2*i*a->ostride]   = buf[2*i];
+                dst[2*i*a->ostride+1] = buf[2*i+1];
+            }
+        }
+    }
+}
+
+static void batch_run(const batch_args* a, size_t b0, size_t b1) {
+    const fft10_plan* plan = a->plan;
+    float*            buf;
+
+    // plans that are a single codelet too long to be a leaf of the lanes run codelet by codelet
+    if(plan->rev && !(plan->codelet == plan->nstages &&
+                      2*plan->n*FFT10_BATCH_LANES*sizeof(float) > FFT10_BATCH_LEAF_BYTES))
+    {
+        buf = (float*)malloc(2*plan->n*FFT10_BATCH_LANES*sizeof(float));
+        if(buf)
+        {
+            batch_simd(a, b0, b1, buf);
+        }
+    }
+    else
+    {
+        buf = (float*)malloc(2*plan->n*sizeof(float));
+        if(buf)
+        {
+            batch_single(a, b0, b1, buf);
+        }
+    }
+    free(buf);
+}
+
+static void batch_task(void* arg, size_t c) {
+    batch_args* a  = (batch_args*)arg;
+    size_t      b0 = c*a->chunk;
+    size_t      b1 = b0 + a->chunk < a->howmany ? b0 + a->chunk : a->howmany;
+
+    batch_run(a, b0, b1);
+}
+
+/*
+ * Function: fft10_execute_many
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Computes howmany transforms of the length of plan. Transform b reads its
+ *     element j from in[b*idist + j*istride] and writes element k to
+ *     out[b*odist + k*ostride]; strides and distances count complex values, like
+ *     read_jump of local_fft_radix10.
+ *
+ * Parameters:
+ *     const fft10_plan* plan:
+ *         Plan of the transform length. FFT10_REAL, double and fixed point
+ *         plans are not batched.
+ *     size_t howmany:
+ *         Number of transforms.
+ *     const float* in, size_t istride, size_t idist:
+ *         Input layout.
+ *     float* out, size_t ostride, size_t odist:
+ *         Output layout. out may be equal to in if the layouts are equal.
+ *
+ * Returns:
+ *     0, or -1 without touching out on FFT10_REAL, double and fixed point plans.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Plans of up to FFT10_BATCH_MAX_BYTES/(8*FFT10_BATCH_LANES) points run one
+ * transform per vector lane, longer ones and Bluestein plans run one transform
+ * at a time. So do plans that are a single codelet (1000 points) whose lanes
+ * would not fit into FFT10_BATCH_LEAF_BYTES: the codelet on its own keeps one
+ * transform in L1 and is faster. Batches with at least FFT10_THREAD_CUTOFF points in total are
+ * split over the thread pool.
+ *
+ * ----------------------------------------------------------------------------
+ */
+int fft10_execute_many(const fft10_plan* plan, size_t howmany,
+                       const float* in, size_t istride, size_t idist,
+                       float* out, size_t ostride, size_t odist) {
+    batch_args a = { plan, howmany, in, istride, idist, out, ostride, odist, howmany };
+    int        nthreads = fft10_get_threads();
+
+    if(plan->flags & (FFT10_REAL | FFT10_PRECISION_MASK))
+    {
+        return -1;
+    }
+    if(howmany == 0)
+    {
+        return 0;
+    }
+
+    // long transforms are split over the threads by fft10_execute itself
+    if(nthreads > 1 && howmany > 1 && howmany*plan->n >= FFT10_THREAD_CUTOFF && plan->n < FFT10_THREAD_CUTOFF)
+    {
+        a.chunk = (howmany + 4*(size_t)nthreads-1)/(4*(size_t)nthreads);
+        a.chunk = (a.chunk + FFT10_KALIGN-1)/FFT10_KALIGN*FFT10_KALIGN;
+        fft10_parallel_for((howmany + a.chunk-1)/a.chunk, batch_task, &a);
+    }
+    else
+    {
+        batch_run(&a, 0, howmany);
+    }
+    return 0;
+}
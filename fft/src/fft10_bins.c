@@ -0,0 +1,722 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_bins.c
+ * Description: Selected output bins of a transform of length n, optionally of
+ * an input that is zero outside a known range. Three methods are planned and
+ * the cheapest one is picked: Goertzel filters per bin, a pruned transform that
+ * computes the first stages completely and only the paths of the wanted bins
+ * through the last one, and a chirp-z zoom onto a contiguous band.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - add Goertzel, pruned and chirp-z transforms of selected bins
+ * 18.10.2026 - the pruned transform skips the columns past the input range
+ *
+ * ----------------------------------------------------------------------------
+ * Usage:
+ * ----------------------------------------------------------------------------
+ *     // 40 bins around 50 Hz of a 10^6 point spectrum
+ *     fft10_bins* b = fft10_bins_create_range(1000000, 4980, 40, 0, 1000000, FFT10_ESTIMATE);
+ *     fft10_bins_execute(b, x, X);   // X holds the 40 bins 4980..5019
+ *     fft10_bins_destroy(b);
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * With the input x_j nonzero only for a <= j < a+L, given as x'_j = x_a+j:
+ *
+ * Goertzel (FFT10_BINS_GOERTZEL), L operations per bin: the second order
+ * recurrence s_j = x_j + 2cos(w)*s_j-1 - s_j-2 of every bin runs in double
+ * precision over segments of BINS_BLOCK values, and every segment is rotated
+ * by an exactly computed W_n^(k*start), so the error does not grow with L.
+ *
+ * Pruned (FFT10_BINS_PRUNED), about c*n1*log(n1) + count*c operations for the
+ * c = min(n2, L) columns that hold input: with n = n1*n2, j = n2*j1 + j2 and
+ * k1 = k mod n1
+ *     X_k = sum_j2 W_n^((a + j2)*k) * Y[k1][j2],  Y[k1][j2] = FFT_n1(x'[n2*j1 + j2])[k1]
+ * (x'_j is zero for j >= L, so the columns j2 >= L are zero). The c transforms
+ * of length n1 run as batches through fft10_execute_many; only the rows k1 of
+ * the wanted bins are kept, and the last stage is one Goertzel filter of
+ * length c per bin. n1 is the divisor of n with the lowest estimated cost.
+ *
+ * Chirp-z (FFT10_BINS_CHIRP), two transforms of length M >= L + count - 1:
+ * for the band k0 <= k < k0+count, with jk = (j^2 + k^2 - (k-j)^2)/2,
+ *     X_k0+q = W^(a*(k0+q)) * W^(q^2/2) * sum_j (x'_j W^(j*k0 + j^2/2)) W^(-(q-j)^2/2)
+ * a convolution computed like fft10_bluestein_execute.
+ *
+ * The object is not changed by fft10_bins_execute, work buffers are allocated
+ * per call.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "fft10_internal.h"
+
+/* values of a Goertzel segment, bins run side by side through one (goertzel is written for 4) */
+#define BINS_BLOCK  1024
+#define BINS_LANES  4
+
+/* columns of the first stage of the pruned transform per panel, at least */
+#define BINS_TILE   16
+
+/* cost estimates per value: a Goertzel step of one bin, a transform per log2 of its length, a copy */
+#define BINS_COST_GOERTZEL  1.0
+#define BINS_COST_FFT       0.6
+#define BINS_COST_COPY      1.0
+
+#define FFT10_BINS_METHODS  (FFT10_BINS_GOERTZEL | FFT10_BINS_PRUNED | FFT10_BINS_CHIRP)
+
+struct fft10_bins {
+    size_t       n;
+    size_t       count;
+    size_t*      bins;
+    size_t       in_first;   // a
+    size_t       in_count;   // L
+    unsigned     method;
+    double       sgn;
+    double       scale;
+    // pruned
+    size_t       n1;
+    size_t       n2;
+    size_t       ncols;      // columns j2 < min(n2, L) that hold input
+    size_t       tile;       // columns per panel
+    size_t       nrows;
+    size_t*      rows;       // k1 of every row of Y
+    size_t*      row;        // row of Y of every bin
+    fft10_plan*  plan;       // length n1, or the forward plan of length M
+    // chirp-z
+    size_t       M;
+    fft10_plan*  bwd;
+    float*       pre;        // L values W^(j*k0 + j^2/2)
+    float*       filt;       // FFT_M of W^(-t^2/2), times 1/M
+    float*       post;       // count values W^(a*k + q^2/2) times the scale
+};
+
+typedef struct {
+    const fft10_bins*  b;
+    const float*       in;
+    float*             out;
+    float*             Y;
+    size_t             count;    // tiles or groups of BINS_LANES bins
+    size_t             chunk;    // of them per task
+} bins_args;
+
+/* a*b mod m, m < 2^63 */
+static unsigned long long mulmod(unsigned long long a, unsigned long long b, unsigned long long m) {
+    unsigned long long r = 0;
+
+    a %= m;
+    b %= m;
+    if(a < (1ull << 32) && b < (1ull << 32))
+    {
+        return a*b % m;
+    }
+    for(; b; b >>= 1)
+    {
+        if(b & 1)
+        {
+            r = r + a >= m ? r + a - m : r + a;
+        }
+        a = a + a >= m ? a + a - m : a + a;
+    }
+    return r;
+}
+
+static double log2_of(size_t n) {
+    return n > 1 ? log((double)n)/log(2.0) : 0.0;
+}
+
+/* estimated cost of a transform of length n, Bluestein for lengths that are not 5-smooth */
+static double fft_cost(size_t n) {
+    size_t M;
+
+    if(fft10_next_smooth(n) == n)
+    {
+        return (double)n*BINS_COST_FFT*log2_of(n);
+    }
+    M = fft10_next_smooth(2*n-1);
+    return (double)M*(2.0*BINS_COST_FFT*log2_of(M) + 3.0*BINS_COST_COPY);
+}
+
+/* items per task, everything in one task below the cutoff */
+static size_t bins_chunk(size_t count, double work) {
+    size_t nthreads = (size_t)fft10_get_threads();
+
+    if(nthreads <= 1 || work < FFT10_THREAD_CUTOFF)
+    {
+        return count;
+    }
+    return (count + 4*nthreads-1)/(4*nthreads);
+}
+
+/*
+ * sum_j x[l][j]*W_n^((first + j)*k[l]) for j < len into acc[2l], acc[2l+1],
+ * for BINS_LANES bins side by side
+ */
+static void goertzel(const fft10_bins* b, const float* const* x, size_t len, size_t first,
+                     const size_t* k, double* acc) {
+    double c[BINS_LANES], er[BINS_LANES], ei[BINS_LANES];
+
+    for(int l = 0; l < BINS_LANES; l++)
+    {
+        double ang = -b->sgn*2.0*FFT10_PI*(double)k[l]/(double)b->n;
+        er[l] = cos(ang);
+        ei[l] = sin(ang);
+        c[l]  = 2.0*er[l];
+        acc[2*l] = acc[2*l+1] = 0.0;
+    }
+
+    for(size_t s0 = 0; s0 < len; s0 += BINS_BLOCK)
+    {
+        size_t        s1 = s0 + BINS_BLOCK < len ? s0 + BINS_BLOCK : len;
+        const float*  x0 = x[0];
+        const float*  x1 = x[1];
+        const float*  x2 = x[2];
+        const float*  x3 = x[3];
+        double        c0 = c[0], c1 = c[1], c2 = c[2], c3 = c[3];
+        double        ar[BINS_LANES], ai[BINS_LANES];   // s_j-1
+        double        br[BINS_LANES], bi[BINS_LANES];   // s_j-2
+
+        // the lanes are written out so the states stay in registers
+        double a0r = 0, a0i = 0, b0r = 0, b0i = 0, a1r = 0, a1i = 0, b1r = 0, b1i = 0;
+        double a2r = 0, a2i = 0, b2r = 0, b2i = 0, a3r = 0, a3i = 0, b3r = 0, b3i = 0;
+        for(size_t j = s0; j < s1; j++)
+        {
+            // x - s_j-2 is ready one step early, the chain of s is one multiply-add
+            double t0r = (x0[2*j] - b0r) + c0*a0r, t0i = (x0[2*j+1] - b0i) + c0*a0i;
+            double t1r = (x1[2*j] - b1r) + c1*a1r, t1i = (x1[2*j+1] - b1i) + c1*a1i;
+            double t2r = (x2[2*j] - b2r) + c2*a2r, t2i = (x2[2*j+1] - b2i) + c2*a2i;
+            double t3r = (x3[2*j] - b3r) + c3*a3r, t3i = (x3[2*j+1] - b3i) + c3*a3i;
+            b0r = a0r; b0i = a0i; a0r = t0r; a0i = t0i;
+            b1r = a1r; b1i = a1i; a1r = t1r; a1i = t1i;
+            b2r = a2r; b2i = a2i; a2r = t2r; a2i = t2i;
+            b3r = a3r; b3i = a3i; a3r = t3r; a3i = t3i;
+        }
+        ar[0] = a0r; ai[0] = a0i; br[0] = b0r; bi[0] = b0i;
+        ar[1] = a1r; ai[1] = a1i; br[1] = b1r; bi[1] = b1i;
+        ar[2] = a2r; ai[2] = a2i; br[2] = b2r; bi[2] = b2i;
+        ar[3] = a3r; ai[3] = a3i; br[3] = b3r; bi[3] = b3i;
+
+        for(int l = 0; l < BINS_LANES; l++)
+        {
+            // sum over the segment = W^(k*(s1-1 - s0)) * (s_s1-1 - W^k * s_s1-2), times W^(k*(first + s0))
+            unsigned long long e   = mulmod(k[l], first + s1 - 1, b->n);
+            double             ang = -b->sgn*2.0*FFT10_PI*(double)e/(double)b->n;
+            double             pr  = cos(ang), pi = sin(ang);
+            double             yr  = ar[l] - (er[l]*br[l] - ei[l]*bi[l]);
+            double             yi  = ai[l] - (er[l]*bi[l] + ei[l]*br[l]);
+
+            acc[2*l]   += pr*yr - pi*yi;
+            acc[2*l+1] += pr*yi + pi*yr;
+        }
+    }
+}
+
+/* groups c*chunk.. of BINS_LANES bins, over the input or over their rows of Y */
+static void goertzel_task(void* arg, size_t c) {
+    bins_args*         a  = (bins_args*)arg;
+    const fft10_bins*  b  = a->b;
+    size_t             g0 = c*a->chunk;
+    size_t             g1 = g0 + a->chunk < a->count ? g0 + a->chunk : a->count;
+
+    for(size_t g = g0; g < g1; g++)
+    {
+        const float*  x[BINS_LANES];
+        size_t        k[BINS_LANES];
+        double        acc[2*BINS_LANES];
+
+        // lanes past the last bin repeat the first bin of the group
+        for(int l = 0; l < BINS_LANES; l++)
+        {
+            size_t i = g*BINS_LANES + l < b->count ? g*BINS_LANES + l : g*BINS_LANES;
+            k[l] = b->bins[i];
+            x[l] = a->Y ? a->Y + 2*b->row[i]*b->ncols : a->in;
+        }
+        goertzel(b, x, a->Y ? b->ncols : b->in_count, b->in_first, k, acc);
+
+        for(int l = 0; l < BINS_LANES && g*BINS_LANES + l < b->count; l++)
+        {
+            a->out[2*(g*BINS_LANES + l)]   = (float)(b->scale*acc[2*l]);
+            a->out[2*(g*BINS_LANES + l)+1] = (float)(b->scale*acc[2*l+1]);
+        }
+    }
+}
+
+/* first stage of the pruned transform: columns j2 of tiles c*chunk.., the wanted rows into Y */
+static void pruned_task(void* arg, size_t c) {
+    bins_args*         a     = (bins_args*)arg;
+    const fft10_bins*  b     = a->b;
+    size_t             n1    = b->n1, n2 = b->n2;
+    size_t             t0    = c*a->chunk;
+    size_t             t1    = t0 + a->chunk < a->count ? t0 + a->chunk : a->count;
+    size_t             width = b->tile < b->ncols ? b->tile : b->ncols;
+    float*             panel;
+    float*             spec;
+
+    panel = (float*)malloc(4*width*n1*sizeof(float));
+    if(!panel)
+    {
+        return;
+    }
+    spec = panel + 2*width*n1;
+
+    for(size_t t = t0; t < t1; t++)
+    {
+        size_t c0 = t*b->tile;
+        size_t w  = c0 + b->tile < b->ncols ? b->tile : b->ncols - c0;
+
+        // a full input is read in place by the batch, otherwise x'[n2*j1 + c0 + q] goes
+        // to panel row q, zero past the input range
+        if(b->in_count == b->n)
+        {
+            fft10_execute_many(b->plan, w, a->in + 2*c0, n2, 1, spec, 1, n1);
+        }
+        else
+        {
+            for(size_t j1 = 0; j1 < n1; j1++)
+            {
+                for(size_t q = 0; q < w; q++)
+                {
+                    size_t j = n2*j1 + c0 + q;
+                    if(j < b->in_count)
+                    {
+                        panel[2*(q*n1 + j1)]   = a->in[2*j];
+                        panel[2*(q*n1 + j1)+1] = a->in[2*j+1];
+                    }
+                    else
+                    {
+                        panel[2*(q*n1 + j1)]   = 0.0f;
+                        panel[2*(q*n1 + j1)+1] = 0.0f;
+                    }
+                }
+            }
+            fft10_execute_many(b->plan, w, panel, 1, n1, spec, 1, n1);
+        }
+
+        for(size_t r = 0; r < b->nrows; r++)
+        {
+            float* y = a->Y + 2*(r*b->ncols + c0);
+            for(size_t q = 0; q < w; q++)
+            {
+                y[2*q]   = spec[2*(q*n1 + b->rows[r])];
+                y[2*q+1] = spec[2*(q*n1 + b->rows[r])+1];
+            }
+        }
+    }
+    free(panel);
+}
+
+static void run_goertzel(const fft10_bins* b, const float* in, float* out, float* Y) {
+    bins_args  a;
+    size_t     len = Y ? b->ncols : b->in_count;
+
+    a.b     = b;
+    a.in    = in;
+    a.out   = out;
+    a.Y     = Y;
+    a.count = (b->count + BINS_LANES-1)/BINS_LANES;
+    a.chunk = bins_chunk(a.count, (double)b->count*(double)len);
+    fft10_parallel_for((a.count + a.chunk-1)/a.chunk, goertzel_task, &a);
+}
+
+static void run_pruned(const fft10_bins* b, const float* in, float* out) {
+    bins_args  a;
+    float*     Y = (float*)malloc(2*b->nrows*b->ncols*sizeof(float));
+
+    if(!Y)
+    {
+        return;
+    }
+    a.b     = b;
+    a.in    = in;
+    a.out   = out;
+    a.Y     = Y;
+    a.count = (b->ncols + b->tile-1)/b->tile;
+    a.chunk = bins_chunk(a.count, (double)b->ncols*(double)b->n1);
+    fft10_parallel_for((a.count + a.chunk-1)/a.chunk, pruned_task, &a);
+
+    run_goertzel(b, in, out, Y);
+    free(Y);
+}
+
+static void run_chirp(const fft10_bins* b, const float* in, float* out) {
+    size_t        L = b->in_count, M = b->M;
+    const float*  w = b->pre;
+    float*        x;
+    float*        X;
+
+    x = (float*)malloc(4*M*sizeof(float));
+    if(!x)
+    {
+        return;
+    }
+    X = x + 2*M;
+
+    for(size_t j = 0; j < L; j++)
+    {
+        float xr = in[2*j], xi = in[2*j+1];
+        x[2*j]   = xr*w[2*j] - xi*w[2*j+1];
+        x[2*j+1] = xr*w[2*j+1] + xi*w[2*j];
+    }
+    memset(x + 2*L, 0, 2*(M-L)*sizeof(float));
+
+    fft10_execute(b->plan, x, X);
+    for(size_t k = 0; k < M; k++)
+    {
+        float ar = X[2*k], ai = X[2*k+1];
+        float br = b->filt[2*k], bi = b->filt[2*k+1];
+        X[2*k]   = ar*br - ai*bi;
+        X[2*k+1] = ar*bi + ai*br;
+    }
+    fft10_execute(b->bwd, X, x);
+
+    for(size_t q = 0; q < b->count; q++)
+    {
+        float cr = x[2*q], ci = x[2*q+1];
+        out[2*q]   = cr*b->post[2*q] - ci*b->post[2*q+1];
+        out[2*q+1] = cr*b->post[2*q+1] + ci*b->post[2*q];
+    }
+    free(x);
+}
+
+/* n1 of the cheapest split n = n1*n2 of the pruned transform, its cost in cost */
+static size_t pruned_split(const fft10_bins* b, double* cost) {
+    size_t best  = b->n;
+    size_t lanes = (b->count + BINS_LANES-1)/BINS_LANES*BINS_LANES;
+
+    *cost = HUGE_VAL;
+    for(size_t d = 1; d <= b->n/d; d++)
+    {
+        if(b->n % d != 0)
+        {
+            continue;
+        }
+        for(int side = 0; side < 2; side++)
+        {
+            // only the columns that hold input are transformed and filtered
+            size_t n1    = side ? b->n/d : d;
+            size_t ncols = b->n/n1 < b->in_count ? b->n/n1 : b->in_count;
+            double c     = (double)ncols*fft_cost(n1) + (double)ncols*(double)n1*BINS_COST_COPY
+                         + (double)lanes*(double)ncols*BINS_COST_GOERTZEL;
+            if(n1 > 1 && c < *cost)
+            {
+                *cost = c;
+                best  = n1;
+            }
+        }
+    }
+    return best;
+}
+
+static int init_pruned(fft10_bins* b, unsigned flags) {
+    size_t* slot;
+
+    b->n2    = b->n/b->n1;
+    b->ncols = b->n2 < b->in_count ? b->n2 : b->in_count;
+    b->tile  = FFT10_BLOCK_BYTES/(4*sizeof(float)*b->n1)/BINS_TILE*BINS_TILE;
+    b->tile = b->tile > BINS_TILE ? b->tile : BINS_TILE;
+    b->plan = fft10_plan_create(b->n1, flags);
+    b->rows = (size_t*)malloc(b->count*sizeof(size_t));
+    b->row  = (size_t*)malloc(b->count*sizeof(size_t));
+    slot    = (size_t*)malloc(b->n1*sizeof(size_t));
+    if(!b->plan || !b->rows || !b->row || !slot)
+    {
+        free(slot);
+        return -1;
+    }
+
+    // one row of Y per distinct k mod n1
+    for(size_t k1 = 0; k1 < b->n1; k1++)
+    {
+        slot[k1] = b->count;
+    }
+    for(size_t i = 0; i < b->count; i++)
+    {
+        size_t k1 = b->bins[i] % b->n1;
+        if(slot[k1] == b->count)
+        {
+            slot[k1] = b->nrows;
+            b->rows[b->nrows++] = k1;
+        }
+        b->row[i] = slot[k1];
+    }
+    free(slot);
+    return 0;
+}
+
+static int init_chirp(fft10_bins* b, unsigned flags) {
+    unsigned long long  n2 = 2ull*b->n;
+    unsigned long long  jj = 0, jk = 0, ka;
+    size_t              L  = b->in_count, m = b->count, k0 = b->bins[0];
+    size_t              tmax = L > m ? L : m;
+    float*              v;
+
+    b->plan = fft10_plan_create(b->M, flags);
+    b->bwd  = fft10_plan_create(b->M, FFT10_BACKWARD_RAW | (flags & FFT10_MEASURE));
+    b->pre  = (float*)malloc(2*L*sizeof(float));
+    b->filt = (float*)malloc(2*b->M*sizeof(float));
+    b->post = (float*)malloc(2*m*sizeof(float));
+    v       = (float*)calloc(2*b->M, sizeof(float));
+    if(!b->plan || !b->bwd || !b->pre || !b->filt || !b->post || !v)
+    {
+        free(v);
+        return -1;
+    }
+
+    // squares and products mod 2n are updated incrementally so the angles stay exact
+    ka = mulmod(k0, b->in_first, b->n);
+    for(size_t t = 0; t < tmax; t++)
+    {
+        double chirp = -b->sgn*FFT10_PI*(double)jj/(double)b->n;   // angle of W^(t^2/2)
+
+        if(t < L)
+        {
+            double ang = -b->sgn*FFT10_PI*(double)((jj + jk) % n2)/(double)b->n;
+            b->pre[2*t]   = (float)cos(ang);
+            b->pre[2*t+1] = (float)sin(ang);
+        }
+        if(t < m)
+        {
+            double ang = chirp - b->sgn*2.0*FFT10_PI*(double)ka/(double)b->n;
+            b->post[2*t]   = (float)(b->scale*cos(ang));
+            b->post[2*t+1] = (float)(b->scale*sin(ang));
+            v[2*t]   = (float)cos(chirp);
+            v[2*t+1] = (float)-sin(chirp);
+        }
+        if(t < L && t > 0)
+        {
+            v[2*(b->M-t)]   = (float)cos(chirp);
+            v[2*(b->M-t)+1] = (float)-sin(chirp);
+        }
+        jj = (jj + 2*(unsigned long long)t + 1) % n2;
+        jk = (jk + 2*(unsigned long long)(k0 % b->n)) % n2;
+        ka = (ka + b->in_first) % b->n;
+    }
+
+    fft10_execute(b->plan, v, b->filt);
+    for(size_t k = 0; k < 2*b->M; k++)
+    {
+        b->filt[k] *= (float)(1.0/(double)b->M);
+    }
+    free(v);
+    return 0;
+}
+
+void fft10_bins_destroy(fft10_bins* b) {
+    if(!b)
+    {
+        return;
+    }
+    fft10_plan_destroy(b->plan);
+    fft10_plan_destroy(b->bwd);
+    free(b->bins);
+    free(b->rows);
+    free(b->row);
+    free(b->pre);
+    free(b->filt);
+    free(b->post);
+    free(b);
+}
+
+/*
+ * Function: fft10_bins_create
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Prepares the computation of the bins X_k, k in bins, of the transform of
+ *     length n of a signal that is zero outside in_first..in_first+in_count-1.
+ *
+ * Parameters:
+ *     size_t n:
+ *         Length of the transform.
+ *     const size_t* bins:
+ *         count bins below n, in any order, copied by the call.
+ *     size_t count:
+ *         Number of bins.
+ *     size_t in_first, size_t in_count:
+ *         The range of the input that may be nonzero, 0 and n for a full
+ *         signal. fft10_bins_execute reads only these in_count values.
+ *     unsigned flags:
+ *         FFT10_ESTIMATE or FFT10_BACKWARD (normalized by 1/n), and either one
+ *         of FFT10_BINS_GOERTZEL, FFT10_BINS_PRUNED and FFT10_BINS_CHIRP or
+ *         none of them for the method with the lowest estimated cost.
+ *         FFT10_MEASURE is passed to the plans.
+ *
+ * Returns:
+ *     The computation, or NULL for invalid arguments, FFT10_BINS_CHIRP with
+ *     bins that are not consecutive (modulo n), several methods at once or
+ *     if memory could not be allocated.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * The chirp-z zoom needs bins k0, k0+1, .. (modulo n); fft10_bins_create_range
+ * gives them. The method chosen is returned by fft10_bins_method.
+ *
+ * ----------------------------------------------------------------------------
+ */
+fft10_bins* fft10_bins_create(size_t n, const size_t* bins, size_t count, size_t in_first, size_t in_count,
+                              unsigned flags) {
+    fft10_bins*  b;
+    unsigned     method = flags & FFT10_BINS_METHODS;
+    unsigned     pflags = (flags & FFT10_BACKWARD ? FFT10_BACKWARD_RAW : 0) | (flags & FFT10_MEASURE);
+    int          band   = 1;
+    double       cost_g, cost_p, cost_c = HUGE_VAL;
+
+    if(n == 0 || count == 0 || in_count == 0 || in_first >= n || in_count > n - in_first ||
+       (flags & (FFT10_REAL | FFT10_PRECISION_MASK)) || (method & (method - 1)))
+    {
+        return NULL;
+    }
+    for(size_t i = 0; i < count; i++)
+    {
+        if(bins[i] >= n)
+        {
+            return NULL;
+        }
+        band = band && bins[i] == (bins[0] + i) % n;
+    }
+    band = band && count <= n;
+    if(method == FFT10_BINS_CHIRP && !band)
+    {
+        return NULL;
+    }
+
+    b = (fft10_bins*)calloc(1, sizeof(*b));
+    if(!b)
+    {
+        return NULL;
+    }
+    b->n        = n;
+    b->count    = count;
+    b->in_first = in_first;
+    b->in_count = in_count;
+    b->sgn      = flags & FFT10_BACKWARD ? -1.0 : 1.0;
+    b->scale    = flags & FFT10_BACKWARD ? 1.0/(double)n : 1.0;
+    b->bins     = (size_t*)malloc(count*sizeof(size_t));
+    if(!b->bins)
+    {
+        fft10_bins_destroy(b);
+        return NULL;
+    }
+    memcpy(b->bins, bins, count*sizeof(size_t));
+
+    // the lanes of a Goertzel group cost the same, used or not
+    cost_g = (double)((count + BINS_LANES-1)/BINS_LANES*BINS_LANES)*(double)in_count*BINS_COST_GOERTZEL;
+    b->n1  = pruned_split(b, &cost_p);
+    if(band)
+    {
+        b->M   = fft10_next_smooth(in_count + count - 1);
+        cost_c = 2.0*fft_cost(b->M) + (double)b->M*3.0*BINS_COST_COPY;
+    }
+    if(!method)
+    {
+        method = cost_g <= cost_p && cost_g <= cost_c ? FFT10_BINS_GOERTZEL :
+                 cost_p <= cost_c                     ? FFT10_BINS_PRUNED   : FFT10_BINS_CHIRP;
+    }
+    b->method = method;
+
+    if((method == FFT10_BINS_PRUNED && init_pruned(b, pflags) != 0) ||
+       (method == FFT10_BINS_CHIRP  && init_chirp(b, pflags & FFT10_MEASURE) != 0))
+    {
+        fft10_bins_destroy(b);
+        return NULL;
+    }
+    return b;
+}
+
+/*
+ * Function: fft10_bins_create_range
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     fft10_bins_create for the count consecutive bins k0, k0+1, .. (modulo n).
+ *
+ * ----------------------------------------------------------------------------
+ */
+fft10_bins* fft10_bins_create_range(size_t n, size_t k0, size_t count, size_t in_first, size_t in_count,
+                                    unsigned flags) {
+    fft10_bins*  b;
+    size_t*      bins;
+
+    if(n == 0 || count == 0 || count > n)
+    {
+        return NULL;
+    }
+    bins = (size_t*)malloc(count*sizeof(size_t));
+    if(!bins)
+    {
+        return NULL;
+    }
+    for(size_t q = 0; q < count; q++)
+    {
+        bins[q] = (k0 % n + q) % n;
+    }
+    b = fft10_bins_create(n, bins, count, in_first, in_count, flags);
+    free(bins);
+    return b;
+}
+
+/*
+ * Function: fft10_bins_method
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     The method of the computation, FFT10_BINS_GOERTZEL, FFT10_BINS_PRUNED or
+ *     FFT10_BINS_CHIRP.
+ *
+ * ----------------------------------------------------------------------------
+ */
+unsigned fft10_bins_method(const fft10_bins* b) {
+    return b->method;
+}
+
+/*
+ * Function: fft10_bins_execute
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Computes the selected bins.
+ *
+ * Parameters:
+ *     const fft10_bins* b:
+ *         Computation returned by fft10_bins_create.
+ *     const float* in:
+ *         The in_count complex values x_in_first.. as interleaved re/im.
+ *     float* out:
+ *         count complex values, X of bins[i] in out[2i], out[2i+1].
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Without memory for the work buffers the call returns and out is unchanged.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_bins_execute(const fft10_bins* b, const float* in, float* out) {
+    if(b->method == FFT10_BINS_PRUNED)
+    {
+        run_pruned(b, in, out);
+    }
+    else if(b->method == FFT10_BINS_CHIRP)
+    {
+        run_chirp(b, in, out);
+    }
+    else
+    {
+        run_goertzel(b, in, out, NULL);
+    }
+}
@@ -0,0 +1,189 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_bluestein.c
+ * Description: Bluestein's algorithm for lengths with a prime factor above 5.
+ * The DFT of length n is written as a convolution with a chirp, which is
+ * evaluated with two transforms of a 5-smooth length M >= 2n-1.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - add Bluestein fallback for arbitrary lengths
+ * 18.10.2026 - scale for normalized backward plans
+ * 18.10.2026 - work buffers may come from the caller
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * With w_j = exp(-sgn*i*pi*j^2/n) and j*k = (j^2 + k^2 - (k-j)^2)/2:
+ *     X_k = w_k * sum_j (x_j*w_j) * conj(w_(k-j))
+ * The transform of the zero padded conj(w) is computed once per plan and
+ * already carries the 1/M of the inverse transform and the scale of the plan.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "fft10_internal.h"
+
+struct fft10_bluestein {
+    size_t       n;
+    size_t       M;
+    float*       chirp;  // w_j, n interleaved complex values
+    float*       filt;   // FFT_M of the zero padded conj(w) times scale/M
+    fft10_plan*  fwd;
+    fft10_plan*  bwd;
+};
+
+static int is_smooth(size_t m) {
+    while(m % 2 == 0) m /= 2;
+    while(m % 3 == 0) m /= 3;
+    while(m % 5 == 0) m /= 5;
+    return m == 1;
+}
+
+size_t fft10_next_smooth(size_t n) {
+    size_t m = n < 1 ? 1 : n;
+
+    while(!is_smooth(m))
+    {
+        m++;
+    }
+    return m;
+}
+
+void fft10_bluestein_destroy(fft10_bluestein* blue) {
+    if(!blue)
+    {
+        return;
+    }
+    fft10_plan_destroy(blue->fwd);
+    fft10_plan_destroy(blue->bwd);
+    free(blue->chirp);
+    free(blue->filt);
+    free(blue);
+}
+
+fft10_bluestein* fft10_bluestein_create(size_t n, float sgn, float scale) {
+    fft10_bluestein* blue;
+    float*           b;
+    size_t           jj = 0;
+
+    blue = (fft10_bluestein*)calloc(1, sizeof(*blue));
+    if(!blue)
+    {
+        return NULL;
+    }
+    blue->n     = n;
+    blue->M     = fft10_next_smooth(2*n-1);
+    blue->chirp = (float*)malloc(2*n*sizeof(float));
+    blue->filt  = (float*)calloc(2*blue->M, sizeof(float));
+    b           = (float*)calloc(2*blue->M, sizeof(float));
+    blue->fwd   = fft10_plan_create(blue->M, FFT10_ESTIMATE);
+    blue->bwd   = fft10_plan_create(blue->M, FFT10_BACKWARD_RAW);
+    if(!blue->chirp || !blue->filt || !b || !blue->fwd || !blue->bwd)
+    {
+        free(b);
+        fft10_bluestein_destroy(blue);
+        return NULL;
+    }
+
+    // j^2 mod 2n is updated incrementally so the angle stays exact for large n
+    for(size_t j = 0; j < n; j++)
+    {
+        double ang = -sgn*FFT10_PI*(double)jj/(double)n;
+        float  re  = (float)cos(ang);
+        float  im  = (float)sin(ang);
+
+        blue->chirp[2*j]   = re;
+        blue->chirp[2*j+1] = im;
+        b[2*j]   = re;
+        b[2*j+1] = -im;
+        if(j > 0)
+        {
+            b[2*(blue->M-j)]   = re;
+            b[2*(blue->M-j)+1] = -im;
+        }
+        jj = (jj + 2*j + 1) % (2*n);
+    }
+
+    fft10_execute(blue->fwd, b, blue->filt);
+    for(size_t k = 0; k < 2*blue->M; k++)
+    {
+        blue->filt[k] *= (float)(scale/(double)blue->M);
+    }
+    free(b);
+    return blue;
+}
+
+/* floats of the work buffers of fft10_bluestein_execute */
+size_t fft10_bluestein_work_size(const fft10_bluestein* blue) {
+    return 4*blue->M;
+}
+
+/*
+ * Transform of the n values in[0], in[in_stride], ... into out. The work
+ * buffers come from work (fft10_bluestein_work_size floats) or, if work is
+ * NULL, are allocated per call so a plan can run on several threads at once.
+ */
+void fft10_bluestein_execute(const fft10_bluestein* blue, const float* in, size_t in_stride, float* out,
+                             float* work) {
+    size_t        n = blue->n;
+    size_t        M = blue->M;
+    const float*  w = blue->chirp;
+    float*        own = NULL;
+    float*        a;
+    float*        A;
+
+    a = work;
+    if(!a)
+    {
+        a = own = (float*)malloc(4*M*sizeof(float));
+        if(!a)
+        {
+            return;
+        }
+    }
+    A = a + 2*M;
+
+    for(size_t j = 0; j < n; j++)
+    {
+        float xr = in[2*j*in_stride], xi = in[2*j*in_stride+1];
+        a[2*j]   = xr*w[2*j] - xi*w[2*j+1];
+        a[2*j+1] = xr*w[2*j+1] + xi*w[2*j];
+    }
+    memset(a + 2*n, 0, 2*(M-n)*sizeof(float));
+
+    fft10_execute(blue->fwd, a, A);
+    for(size_t k = 0; k < M; k++)
+    {
+        float ar = A[2*k], ai = A[2*k+1];
+        float br = blue->filt[2*k], bi = blue->filt[2*k+1];
+        A[2*k]   = ar*br - ai*bi;
+        A[2*k+1] = ar*bi + ai*br;
+    }
+    fft10_execute(blue->bwd, A, a);
+
+    for(size_t k = 0; k < n; k++)
+    {
+        float cr = a[2*k], ci = a[2*k+1];
+        out[2*k]   = cr*w[2*k] - ci*w[2*k+1];
+        out[2*k+1] = cr*w[2*k+1] + ci*w[2*k];
+    }
+    free(own);
+}
@@ -0,0 +1,273 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_conv.c
+ * Description: Streaming fft convolution of a real signal with a real FIR
+ * filter (overlap-save or overlap-add). The spectrum of the filter is computed
+ * once; every block of input costs one real forward and one real backward
+ * transform instead of block*taps multiplications. Long filters can be split
+ * into partitions of the block length (uniformly partitioned convolution), so
+ * the transform size and the latency follow the block length and not the
+ * filter length.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - add overlap-save/overlap-add and partitioned convolution
+ * 18.10.2026 - scratch of the transforms allocated once by fft10_conv_create
+ *
+ * ----------------------------------------------------------------------------
+ * Usage:
+ * ----------------------------------------------------------------------------
+ *     fft10_conv* c = fft10_conv_create(h, 4000, 256, FFT10_CONV_PARTITIONED);
+ *     while(read_block(x, 256))
+ *     {
+ *         fft10_conv_process(c, x, y);   // y = next 256 samples of h*x
+ *     }
+ *     fft10_conv_destroy(c);
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * The filter is cut into nparts partitions of part_len taps and the transform
+ * size nfft is the smallest even 5-smooth length >= block + part_len - 1. The
+ * spectra of the last nparts input blocks are kept in a ring (frequency domain
+ * delay line); output block t is the inverse transform of
+ *     sum_p X_(t-p) * H_p
+ * Without FFT10_CONV_PARTITIONED there is one partition holding every tap.
+ * Correlation with a filter is convolution with its reversed taps.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "fft10_internal.h"
+
+struct fft10_conv {
+    size_t       block;
+    size_t       part_len;
+    size_t       nparts;
+    size_t       nfft;
+    size_t       nbins;      // nfft/2 + 1
+    unsigned     flags;
+    fft10_plan*  plan;       // FFT10_REAL plan of length nfft
+    float*       H;          // nparts spectra of nbins complex values
+    float*       fdl;        // nparts input spectra, a ring starting at head
+    size_t       head;
+    float*       window;     // last nfft input samples (overlap-save)
+    float*       tail;       // nfft - block samples still to be added (overlap-add)
+    float*       work;       // nfft + 2 floats
+    float*       scratch;    // scratch of the transforms, NULL if they need none
+};
+
+/*
+ * Function: fft10_conv_create
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Creates a convolution of a real signal, fed in blocks of block samples,
+ *     with the real filter h.
+ *
+ * Parameters:
+ *     const float* h:
+ *         The taps of the filter, copied by the call.
+ *     size_t taps:
+ *         Number of taps.
+ *     size_t block:
+ *         Number of samples passed to every fft10_conv_process call.
+ *     unsigned flags:
+ *         FFT10_CONV_OVERLAP_SAVE (default) or FFT10_CONV_OVERLAP_ADD, optionally
+ *         combined with FFT10_CONV_PARTITIONED.
+ *
+ * Returns:
+ *     The convolution, or NULL if taps or block is 0 or memory could not be
+ *     allocated.
+ *
+ * ----------------------------------------------------------------------------
+ */
+fft10_conv* fft10_conv_create(const float* h, size_t taps, size_t block, unsigned flags) {
+    fft10_conv* conv;
+    size_t      nbins;
+    size_t      nscratch = 0;
+
+    if(taps == 0 || block == 0)
+    {
+        return NULL;
+    }
+
+    conv = (fft10_conv*)calloc(1, sizeof(*conv));
+    if(!conv)
+    {
+        return NULL;
+    }
+    conv->block    = block;
+    conv->flags    = flags;
+    conv->part_len = (flags & FFT10_CONV_PARTITIONED) ? block : taps;
+    conv->nparts   = (taps + conv->part_len-1)/conv->part_len;
+    conv->nfft     = 2*fft10_next_smooth((block + conv->part_len)/2);
+    conv->nbins    = nbins = conv->nfft/2 + 1;
+
+    conv->plan   = fft10_plan_create(conv->nfft, FFT10_REAL);
+    conv->H      = (float*)malloc(2*nbins*conv->nparts*sizeof(float));
+    conv->fdl    = (float*)malloc(2*nbins*conv->nparts*sizeof(float));
+    conv->window = (float*)malloc(conv->nfft*sizeof(float));
+    conv->tail   = (float*)malloc(conv->nfft*sizeof(float));
+    conv->work   = (float*)malloc((conv->nfft + 2)*sizeof(float));
+    if(conv->plan)
+    {
+        nscratch      = fft10_real_work_size(conv->plan->real);
+        conv->scratch = nscratch ? (float*)malloc(nscratch*sizeof(float)) : NULL;
+    }
+    if(!conv->plan || !conv->H || !conv->fdl || !conv->window || !conv->tail || !conv->work ||
+       (nscratch && !conv->scratch))
+    {
+        fft10_conv_destroy(conv);
+        return NULL;
+    }
+
+    for(size_t p = 0; p < conv->nparts; p++)
+    {
+        size_t t0 = p*conv->part_len;
+        size_t t1 = t0 + conv->part_len < taps ? t0 + conv->part_len : taps;
+
+        memset(conv->work, 0, conv->nfft*sizeof(float));
+        memcpy(conv->work, h + t0, (t1 - t0)*sizeof(float));
+        fft10_real_r2c(conv->plan->real, conv->work, conv->H + 2*nbins*p, conv->scratch);
+    }
+    fft10_conv_reset(conv);
+    return conv;
+}
+
+/*
+ * Function: fft10_conv_reset
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Clears the history, the next block is filtered as if it was the first.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_conv_reset(fft10_conv* conv) {
+    memset(conv->fdl, 0, 2*conv->nbins*conv->nparts*sizeof(float));
+    memset(conv->window, 0, conv->nfft*sizeof(float));
+    memset(conv->tail, 0, conv->nfft*sizeof(float));
+    conv->head = 0;
+}
+
+/*
+ * Function: fft10_conv_process
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Filters the next block of the signal.
+ *
+ * Parameters:
+ *     fft10_conv* conv:
+ *         Convolution returned by fft10_conv_create.
+ *     const float* in:
+ *         block input samples.
+ *     float* out:
+ *         block output samples, y[n] = sum_k h[k]*x[n-k] of the stream. May be
+ *         equal to in.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * No memory is allocated: the scratch of the transforms, such as the copy the
+ * in-place inverse makes when its plan is not palindromic, is allocated by
+ * fft10_conv_create. A convolution holds the state of one stream and may not be
+ * used by two threads at the same time.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_conv_process(fft10_conv* conv, const float* in, float* out) {
+    size_t  B     = conv->block;
+    size_t  N     = conv->nfft;
+    size_t  nbins = conv->nbins;
+    float*  X     = conv->fdl + 2*nbins*conv->head;
+    float*  y     = conv->work;
+
+    // spectrum of the newest input, stored at the head of the delay line
+    if(conv->flags & FFT10_CONV_OVERLAP_ADD)
+    {
+        memcpy(y, in, B*sizeof(float));
+        memset(y + B, 0, (N - B)*sizeof(float));
+        fft10_real_r2c(conv->plan->real, y, X, conv->scratch);
+    }
+    else
+    {
+        memmove(conv->window, conv->window + B, (N - B)*sizeof(float));
+        memcpy(conv->window + N - B, in, B*sizeof(float));
+        fft10_real_r2c(conv->plan->real, conv->window, X, conv->scratch);
+    }
+
+    // Y = sum_p X_(t-p)*H_p, partition p pairs with the spectrum p blocks back
+    memset(y, 0, 2*nbins*sizeof(float));
+    for(size_t p = 0; p < conv->nparts; p++)
+    {
+        size_t       slot = (conv->head + conv->nparts - p) % conv->nparts;
+        const float* a    = conv->fdl + 2*nbins*slot;
+        const float* b    = conv->H + 2*nbins*p;
+        for(size_t k = 0; k < nbins; k++)
+        {
+            y[2*k]   += a[2*k]*b[2*k]   - a[2*k+1]*b[2*k+1];
+            y[2*k+1] += a[2*k]*b[2*k+1] + a[2*k+1]*b[2*k];
+        }
+    }
+    conv->head = (conv->head + 1) % conv->nparts;
+
+    fft10_real_c2r(conv->plan->real, y, y, conv->scratch);
+
+    if(conv->flags & FFT10_CONV_OVERLAP_ADD)
+    {
+        // the first B samples are complete, the other N-B overlap the next blocks
+        float* tail = conv->tail;
+        size_t ntail = N - B;
+        for(size_t i = 0; i < B; i++)
+        {
+            out[i] = y[i] + (i < ntail ? tail[i] : 0.0f);
+        }
+        for(size_t i = 0; i < ntail; i++)
+        {
+            tail[i] = y[B + i] + (B + i < ntail ? tail[B + i] : 0.0f);
+        }
+    }
+    else
+    {
+        // only the last B samples are free of circular wrap around
+        memcpy(out, y + N - B, B*sizeof(float));
+    }
+}
+
+/*
+ * Function: fft10_conv_destroy
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Frees a convolution returned by fft10_conv_create.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_conv_destroy(fft10_conv* conv) {
+    if(!conv)
+    {
+        return;
+    }
+    fft10_plan_destroy(conv->plan);
+    free(conv->H);
+    free(conv->fdl);
+    free(conv->window);
+    free(conv->tail);
+    free(conv->work);
+    free(conv->scratch);
+    free(conv);
+}
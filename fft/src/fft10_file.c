@@ -0,0 +1,469 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_file.c
+ * Description: Out-of-core transforms of signals that do not fit into memory.
+ * The input and the output file are memory mapped and the transform of length
+ * n = n1*n2 is computed with the four-step algorithm: n2 transforms of length
+ * n1 over the columns, a twiddle multiplication, and n1 transforms of length n2
+ * over the rows. Both passes move panels of columns through a buffer of at most
+ * mem_bytes, so the memory used does not grow with n.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - add four-step out-of-core transform of memory mapped files
+ * 18.10.2026 - define _POSIX_C_SOURCE for ftruncate under -std=c99
+ * 18.10.2026 - the in-core branch counts the scratch of the plan
+ *
+ * ----------------------------------------------------------------------------
+ * Usage:
+ * ----------------------------------------------------------------------------
+ *     // signal.bin holds n complex values as interleaved float re/im
+ *     if(fft10_execute_file("signal.bin", "spectrum.bin", FFT10_ESTIMATE, 256u << 20) != 0)
+ *     {
+ *         // could not open, map or split the file
+ *     }
+ *
+ * ----------------------------------------------------------------------------
+ * Dependencies:
+ * ----------------------------------------------------------------------------
+ * mmap (POSIX) or file mappings (Windows). Files above 4 GB need a 64 bit
+ * build, the whole file is mapped at once.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * With j = n2*j1 + j2 and k = k1 + n1*k2 the input is a n1 x n2 matrix x[j1][j2]
+ * and
+ *     X[k1 + n1*k2] = sum_j2 W_n^(j2*k1) * (sum_j1 x[j1][j2]*W_n1^(j1*k1)) * W_n2^(j2*k2)
+ * Pass 1 transforms a panel of columns j2 of the input and writes it transposed,
+ * as rows Y[j2][k1] of the output file. Pass 2 transforms the columns k1 of Y in
+ * place; the result of column k1 lands in the same column of the output, which
+ * read as a n2 x n1 matrix is X[k2][k1], the output in natural order. Every
+ * access to the files is a run of panel-width complex values, indices are
+ * size_t throughout.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#define _POSIX_C_SOURCE 200112L     // ftruncate under -std=c99
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "fft10_internal.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/* columns of a panel moved by one task; the twiddles are recomputed exactly every TW_RESEED values */
+#define FILE_TILE   16
+#define TW_RESEED   64
+
+typedef struct {
+    float*  ptr;
+    size_t  bytes;
+#ifdef _WIN32
+    HANDLE  file;
+    HANDLE  map;
+#else
+    int     fd;
+#endif
+} file_map;
+
+#ifdef _WIN32
+
+static void map_close(file_map* m) {
+    if(m->ptr)
+    {
+        UnmapViewOfFile(m->ptr);
+    }
+    if(m->map)
+    {
+        CloseHandle(m->map);
+    }
+    if(m->file != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(m->file);
+    }
+}
+
+/* maps path read only (bytes == 0, the size is taken from the file) or creates it with bytes bytes */
+static int map_open(file_map* m, const char* path, size_t bytes) {
+    int           create = bytes != 0;
+    LARGE_INTEGER size;
+
+    m->ptr  = NULL;
+    m->map  = NULL;
+    m->file = CreateFileA(path, create ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+                          create ? 0 : FILE_SHARE_READ, NULL,
+                          create ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(m->file == INVALID_HANDLE_VALUE)
+    {
+        return -1;
+    }
+    if(!create)
+    {
+        if(!GetFileSizeEx(m->file, &size) || size.QuadPart == 0)
+        {
+            map_close(m);
+            return -1;
+        }
+        bytes = (size_t)size.QuadPart;
+    }
+    size.QuadPart = (LONGLONG)bytes;
+
+    m->bytes = bytes;
+    m->map   = CreateFileMappingA(m->file, NULL, create ? PAGE_READWRITE : PAGE_READONLY,
+                                  (DWORD)(size.QuadPart >> 32), (DWORD)size.QuadPart, NULL);
+    if(m->map)
+    {
+        m->ptr = (float*)MapViewOfFile(m->map, create ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, bytes);
+    }
+    if(!m->ptr)
+    {
+        map_close(m);
+        return -1;
+    }
+    return 0;
+}
+
+#else
+
+static void map_close(file_map* m) {
+    if(m->ptr)
+    {
+        munmap(m->ptr, m->bytes);
+    }
+    if(m->fd >= 0)
+    {
+        close(m->fd);
+    }
+}
+
+/* maps path read only (bytes == 0, the size is taken from the file) or creates it with bytes bytes */
+static int map_open(file_map* m, const char* path, size_t bytes) {
+    int          create = bytes != 0;
+    struct stat  st;
+    void*        p;
+
+    m->ptr = NULL;
+    m->fd  = create ? open(path, O_RDWR | O_CREAT | O_TRUNC, 0644) : open(path, O_RDONLY);
+    if(m->fd < 0)
+    {
+        return -1;
+    }
+    if(create)
+    {
+        if(ftruncate(m->fd, (off_t)bytes) != 0)
+        {
+            map_close(m);
+            return -1;
+        }
+    }
+    else
+    {
+        if(fstat(m->fd, &st) != 0 || st.st_size <= 0)
+        {
+            map_close(m);
+            return -1;
+        }
+        bytes = (size_t)st.st_size;
+    }
+
+    m->bytes = bytes;
+    p = mmap(NULL, bytes, create ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, m->fd, 0);
+    if(p == MAP_FAILED)
+    {
+        map_close(m);
+        return -1;
+    }
+    m->ptr = (float*)p;
+    return 0;
+}
+
+#endif
+
+typedef struct {
+    const float*  src;      // panel source, column c0 of a matrix with src_ld columns
+    size_t        src_ld;
+    float*        dst;      // first output value of the panel
+    size_t        dst_ld;
+    float*        buf;      // ncols transforms of len values, one after the other
+    size_t        len;
+    size_t        ncols;
+    size_t        c0;
+    size_t        n;        // total length, for the twiddles of pass 1
+    double        sgn;
+} panel_args;
+
+/* columns t*FILE_TILE.. of the panel into the rows of buf */
+static void gather_task(void* arg, size_t t) {
+    panel_args*  a  = (panel_args*)arg;
+    size_t       q0 = t*FILE_TILE;
+    size_t       q1 = q0 + FILE_TILE < a->ncols ? q0 + FILE_TILE : a->ncols;
+
+    for(size_t r = 0; r < a->len; r++)
+    {
+        const float* s = a->src + 2*r*a->src_ld;
+        for(size_t q = q0; q < q1; q++)
+        {
+            a->buf[2*(q*a->len + r)]   = s[2*q];
+            a->buf[2*(q*a->len + r)+1] = s[2*q+1];
+        }
+    }
+}
+
+/* pass 1: row q of buf times W_n^((c0+q)*k1), written to row c0+q of Y */
+static void twiddle_task(void* arg, size_t t) {
+    panel_args*  a  = (panel_args*)arg;
+    size_t       q0 = t*FILE_TILE;
+    size_t       q1 = q0 + FILE_TILE < a->ncols ? q0 + FILE_TILE : a->ncols;
+
+    for(size_t q = q0; q < q1; q++)
+    {
+        size_t        j2   = a->c0 + q;
+        const float*  s    = a->buf + 2*q*a->len;
+        float*        d    = a->dst + 2*q*a->len;
+        double        step = -a->sgn*2.0*FFT10_PI*(double)j2/(double)a->n;
+        double        sr   = cos(step), si = sin(step);
+        double        wr   = 1.0, wi = 0.0;
+
+        for(size_t k1 = 0; k1 < a->len; k1++)
+        {
+            if(k1 % TW_RESEED == 0)
+            {
+                // j2*k1 < n, exact in a double up to 2^53
+                double ang = -a->sgn*2.0*FFT10_PI*(double)(j2*k1)/(double)a->n;
+                wr = cos(ang);
+                wi = sin(ang);
+            }
+            float  w_r = (float)wr, w_i = (float)wi;
+            float  xr  = s[2*k1], xi = s[2*k1+1];
+            d[2*k1]   = xr*w_r - xi*w_i;
+            d[2*k1+1] = xr*w_i + xi*w_r;
+
+            double t_r = wr*sr - wi*si;
+            wi = wr*si + wi*sr;
+            wr = t_r;
+        }
+    }
+}
+
+/* pass 2: rows of buf back into the columns of the panel */
+static void scatter_task(void* arg, size_t t) {
+    panel_args*  a  = (panel_args*)arg;
+    size_t       q0 = t*FILE_TILE;
+    size_t       q1 = q0 + FILE_TILE < a->ncols ? q0 + FILE_TILE : a->ncols;
+
+    for(size_t r = 0; r < a->len; r++)
+    {
+        float* d = a->dst + 2*r*a->dst_ld;
+        for(size_t q = q0; q < q1; q++)
+        {
+            d[2*q]   = a->buf[2*(q*a->len + r)];
+            d[2*q+1] = a->buf[2*(q*a->len + r)+1];
+        }
+    }
+}
+
+/* n1 <= n2 with n1*n2 = n and n1 as close to sqrt(n) as possible, 1 for primes */
+static size_t split_length(size_t n) {
+    size_t n1 = (size_t)sqrt((double)n);
+
+    while(n1 > 1 && (size_t)(n1+1)*(n1+1) <= n)
+    {
+        n1++;
+    }
+    while(n1 > 1 && n1*n1 > n)
+    {
+        n1--;
+    }
+    while(n1 > 1 && n % n1 != 0)
+    {
+        n1--;
+    }
+    return n1;
+}
+
+/* both passes of the four-step transform, 0 on success */
+static int four_step(const float* in, float* out, size_t n, size_t n1, unsigned flags, size_t mem_bytes) {
+    size_t       n2    = n/n1;
+    size_t       cols  = mem_bytes/(2*sizeof(float)*n2);
+    fft10_plan*  p1    = fft10_plan_create(n1, flags);
+    fft10_plan*  p2    = fft10_plan_create(n2, flags);
+    float*       buf   = NULL;
+    panel_args   a;
+    int          err   = -1;
+
+    if(cols > FILE_TILE)
+    {
+        cols -= cols % FILE_TILE;
+    }
+    if(cols > n2)
+    {
+        cols = n2;
+    }
+    if(cols > 0 && p1 && p2)
+    {
+        buf = (float*)malloc(2*cols*n2*sizeof(float));
+    }
+    if(!buf)
+    {
+        goto done;
+    }
+
+    a.buf = buf;
+    a.n   = n;
+    a.sgn = p1->sgn;
+
+    // pass 1: columns j2 of the n1 x n2 input, written as rows of Y
+    for(size_t c0 = 0; c0 < n2; c0 += cols)
+    {
+        a.c0     = c0;
+        a.ncols  = c0 + cols < n2 ? cols : n2 - c0;
+        a.len    = n1;
+        a.src    = in + 2*c0;
+        a.src_ld = n2;
+        a.dst    = out + 2*c0*n1;
+        fft10_parallel_for((a.ncols + FILE_TILE-1)/FILE_TILE, gather_task, &a);
+        fft10_execute_many(p1, a.ncols, buf, 1, n1, buf, 1, n1);
+        fft10_parallel_for((a.ncols + FILE_TILE-1)/FILE_TILE, twiddle_task, &a);
+    }
+
+    // pass 2: columns k1 of the n2 x n1 matrix Y, in place
+    for(size_t c0 = 0; c0 < n1; c0 += cols)
+    {
+        a.c0     = c0;
+        a.ncols  = c0 + cols < n1 ? cols : n1 - c0;
+        a.len    = n2;
+        a.src    = out + 2*c0;
+        a.src_ld = n1;
+        a.dst    = out + 2*c0;
+        a.dst_ld = n1;
+        fft10_parallel_for((a.ncols + FILE_TILE-1)/FILE_TILE, gather_task, &a);
+        fft10_execute_many(p2, a.ncols, buf, 1, n2, buf, 1, n2);
+        fft10_parallel_for((a.ncols + FILE_TILE-1)/FILE_TILE, scatter_task, &a);
+    }
+    err = 0;
+
+done:
+    free(buf);
+    fft10_plan_destroy(p1);
+    fft10_plan_destroy(p2);
+    return err;
+}
+
+/*
+ * Function: fft10_execute_file
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Transforms the signal stored in the file in_path and writes the spectrum
+ *     to the file out_path, without holding either of them in memory.
+ *
+ * Parameters:
+ *     const char* in_path:
+ *         File of n complex values as interleaved float re/im (8n bytes), in
+ *         the byte order of the machine.
+ *     const char* out_path:
+ *         File the n complex values of the result are written to. It is created
+ *         or truncated and must not be the input file.
+ *     unsigned flags:
+ *         FFT10_ESTIMATE or FFT10_BACKWARD, passed to the plans of the passes.
+ *         FFT10_REAL and the double and fixed point flags are rejected, the
+ *         files hold complex float values.
+ *     size_t mem_bytes:
+ *         Upper bound for the buffer of a pass. Signals of up to mem_bytes/16
+ *         points are transformed in one piece if the scratch of their plan
+ *         (4*M floats for Bluestein lengths, M >= 2n-1) fits in the rest.
+ *
+ * Returns:
+ *     0 on success, -1 for unsupported flags, if a file could not be opened
+ *     or mapped, memory could not be allocated or n has no factor n1 with
+ *     max(n1, n/n1) points fitting into mem_bytes (e.g. a large prime n).
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * The memory use is bounded by mem_bytes plus the plans of lengths n1 and n2,
+ * both about sqrt(n). Pages of the mapped files are part of the page cache and
+ * are written back and dropped by the system as needed.
+ *
+ * ----------------------------------------------------------------------------
+ */
+int fft10_execute_file(const char* in_path, const char* out_path, unsigned flags, size_t mem_bytes) {
+    file_map     fin, fout;
+    size_t       n, n1;
+    fft10_plan*  plan = NULL;
+    int          err = -1;
+
+    if(flags & (FFT10_REAL | FFT10_PRECISION_MASK))
+    {
+        return -1;
+    }
+    if(map_open(&fin, in_path, 0) != 0)
+    {
+        return -1;
+    }
+    n = fin.bytes/(2*sizeof(float));
+    if(n == 0 || map_open(&fout, out_path, 2*n*sizeof(float)) != 0)
+    {
+        map_close(&fin);
+        return -1;
+    }
+
+    // in one piece if the signal and the scratch of its plan (Bluestein) fit into mem_bytes
+    if(n <= mem_bytes/(4*sizeof(float)))
+    {
+        plan = fft10_plan_create(n, flags);
+        if(plan && fft10_work_size(plan, 0) > mem_bytes/sizeof(float) - 4*n)
+        {
+            fft10_plan_destroy(plan);
+            plan = NULL;
+        }
+    }
+
+    if(plan)
+    {
+        size_t nwork = fft10_work_size(plan, 0);
+        float* work  = nwork ? (float*)malloc(nwork*sizeof(float)) : NULL;
+        if(!nwork || work)
+        {
+            fft10_execute_work(plan, fin.ptr, fout.ptr, work);
+            err = 0;
+        }
+        free(work);
+        fft10_plan_destroy(plan);
+    }
+    else
+    {
+        n1 = split_length(n);
+        if(n1 > 1 && n/n1 <= mem_bytes/(2*sizeof(float)))
+        {
+            err = four_step(fin.ptr, fout.ptr, n, n1, flags, mem_bytes);
+        }
+    }
+
+    map_close(&fout);
+    map_close(&fin);
+    return err;
+}
@@ -0,0 +1,259 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_internal.h
+ * Description: Internal definitions shared by the fft10 source files (plan layout,
+ * plan cache locking and the engine entry points). Not part of the public API.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#ifndef __FFT10_INTERNAL__H__
+#define __FFT10_INTERNAL__H__
+
+#include <stddef.h>
+#include "../include/fft10.h"
+
+#define FFT10_PI          3.14159265358979323846
+#define FFT10_MAX_STAGES  64
+
+/* the iterative engine runs all stages of a block of this size before moving on */
+#ifndef FFT10_BLOCK_BYTES
+#define FFT10_BLOCK_BYTES          (128*1024)
+#endif
+/* out-of-place transforms with more data than this use the iterative engine */
+#ifndef FFT10_RECURSIVE_MAX_BYTES
+#define FFT10_RECURSIVE_MAX_BYTES  (1024*1024)
+#endif
+
+/* transforms (and blocks of the iterative engine) of at least this many points are split over the thread pool */
+#ifndef FFT10_THREAD_CUTOFF
+#define FFT10_THREAD_CUTOFF        32768
+#endif
+/* smallest number of k handed to one thread in a combine pass */
+#ifndef FFT10_THREAD_MIN_CHUNK
+#define FFT10_THREAD_MIN_CHUNK     1024
+#endif
+/* k ranges split over threads start at multiples of this (widest kernel step) */
+#define FFT10_KALIGN               16
+
+/* batches run side by side while the transforms of one vector fit into this */
+#ifndef FFT10_BATCH_MAX_BYTES
+#define FFT10_BATCH_MAX_BYTES      (64*1024)
+#endif
+/* most transforms held by one vector (AVX-512) */
+#define FFT10_BATCH_LANES          8
+/* codelet stages of a batch run block by block while a block of all lanes fits into this */
+#ifndef FFT10_BATCH_LEAF_BYTES
+#define FFT10_BATCH_LEAF_BYTES     (16*1024)
+#endif
+
+/* shortest timed round of one candidate plan of FFT10_MEASURE */
+#ifndef FFT10_MEASURE_SECONDS
+#define FFT10_MEASURE_SECONDS      0.002
+#endif
+
+/* locking used by the process-wide plan cache */
+#ifndef FFT10_NO_THREADS
+#include <pthread.h>
+typedef pthread_mutex_t fft10_mutex;
+#define FFT10_MUTEX_INITIALIZER  PTHREAD_MUTEX_INITIALIZER
+#define fft10_mutex_lock(m)      pthread_mutex_lock(m)
+#define fft10_mutex_unlock(m)    pthread_mutex_unlock(m)
+#else
+typedef int fft10_mutex;
+#define FFT10_MUTEX_INITIALIZER  0
+#define fft10_mutex_lock(m)      ((void)(m))
+#define fft10_mutex_unlock(m)    ((void)(m))
+#endif
+
+/*
+ * Probes of the opt-in instrumentation (fft10_profile.c). FFT10_PROF_BEGIN
+ * declares the mark, FFT10_PROF_END records the work done since then. Without
+ * FFT10_PROFILE both expand to nothing and their arguments are not evaluated.
+ */
+#ifdef FFT10_PROFILE
+typedef struct {
+    unsigned            on;
+    unsigned long long  t;
+    unsigned long long  hw[3];
+} fft10_prof_mark;
+
+void fft10_prof_begin(fft10_prof_mark* mark);
+void fft10_prof_end(const fft10_prof_mark* mark, int kind, int index, int stage, size_t calls, size_t bytes);
+
+#define FFT10_PROF_BEGIN(mark)  fft10_prof_mark mark; fft10_prof_begin(&mark)
+#define FFT10_PROF_END(mark, kind, index, stage, calls, bytes) \
+    fft10_prof_end(&mark, kind, index, stage, calls, bytes)
+#else
+#define FFT10_PROF_BEGIN(mark)  ((void)0)
+#define FFT10_PROF_END(mark, kind, index, stage, calls, bytes)  ((void)0)
+#endif
+
+/* backward transform without the 1/n scaling, used inside the library */
+#define FFT10_BACKWARD_RAW  (1u << 31)
+/* plans executed by fft10_precision.c instead of the float engines */
+#define FFT10_PRECISION_MASK  (FFT10_DOUBLE | FFT10_Q15 | FFT10_Q31)
+
+typedef struct fft10_bluestein fft10_bluestein;
+typedef struct fft10_real fft10_real;
+
+/*
+ * A plan for a length n transform.
+ *
+ * n = radix[0]*radix[1]*...*radix[nstages-1] with radices 2, 3, 4, 5, 8 or 10.
+ * Stage s combines radix[s] sub-transforms of length span[s]/radix[s] into one
+ * of length span[s] (stage 0 is the leaf DFT, span[nstages-1] = n). tw[s] holds
+ * the twiddles W_L^(r*k) of that stage, L = span[s], r = 1..radix[s]-1,
+ * k = 0..L/radix[s]-1, laid out as interleaved complex values in [r-1][k] order
+ * so that consecutive k are contiguous.
+ *
+ * Up to three leading radix 10 stages (spans 10, 100, 1000) are run by the
+ * unrolled codelets of fft10_kernels.c when the recursive engine reaches them.
+ *
+ * engine is the engine of out-of-place executions chosen by FFT10_MEASURE
+ * (FFT10_RECURSIVE or FFT10_ITERATIVE), 0 leaves it to fft10_execute.
+ *
+ * Plans short enough for the batch engine (FFT10_BATCH_MAX_BYTES) keep the
+ * digit reversal permutation in rev.
+ *
+ * FFT10_DOUBLE, FFT10_Q15 and FFT10_Q31 plans keep their twiddles in twx, as
+ * double, int16_t or int32_t in the layout of tw, and have no float tables.
+ *
+ * Lengths with prime factors above 5 have no stages; they are computed by the
+ * Bluestein plan blue on top of two plans of a 5-smooth length. FFT10_REAL
+ * plans have no stages either, real holds the complex plans they run on.
+ */
+struct fft10_plan {
+    size_t              n;
+    unsigned            flags;
+    float               sgn;        // +1 forward, -1 backward
+    float               scale;      // 1/n for FFT10_BACKWARD, else 1; applied at the leaves
+    int                 nstages;
+    int                 radix[FFT10_MAX_STAGES];
+    size_t              span[FFT10_MAX_STAGES];
+    float*              tw[FFT10_MAX_STAGES];
+    float*              tw_mem;
+    void*               twx[FFT10_MAX_STAGES];  // twiddles of double/fixed point plans
+    void*               twx_mem;
+    int                 palindromic; // digit reversal is its own inverse
+    int                 codelet;    // leading radix 10 stages run by fft10_codelet (0..3)
+    unsigned            engine;     // out-of-place engine chosen by the planner, or 0
+    size_t*             rev;        // digit reversal of small plans, for batches
+    fft10_bluestein*    blue;
+    fft10_real*         real;       // FFT10_REAL plans
+    int                 refcount;
+    struct fft10_plan*  next;
+};
+
+/*
+ * Decomposition of a plan: the radices (stage 0 first), the most leading radix
+ * 10 stages run by codelets and the engine of out-of-place executions. The
+ * measuring planner builds plans of several shapes and keeps the fastest.
+ */
+typedef struct {
+    int         nstages;
+    int         radix[FFT10_MAX_STAGES];
+    int         codelets;
+    unsigned    engine;
+} fft10_shape;
+
+/* variants of fft10_factor */
+#define FFT10_SHAPE_NO10     (1u << 0)   // 2 and 5 as separate stages
+#define FFT10_SHAPE_NO8      (1u << 1)   // powers of two as radix 4 (and 2) stages
+#define FFT10_SHAPE_REVERSE  (1u << 2)   // small radices at the leaves and the top
+
+/* SIMD kernels are built with per-function target attributes on x86 gcc/clang */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(FFT10_NO_SIMD)
+#define FFT10_HAVE_X86_SIMD
+#endif
+
+/*
+ * Kernels of one instruction set. A pass function processes k = k..kend-1 in
+ * steps of its vector width and returns the first k it did not process.
+ */
+typedef size_t (*fft10_pass_fn)(float* x, size_t m, const float* tw, size_t k, size_t kend, float sgn);
+
+/*
+ * A batch function runs one stage on kstep transforms stored side by side,
+ * see FFT10_DEFINE_BATCH in fft10_butterflies.inc.
+ */
+typedef void (*fft10_batch_fn)(float* x, size_t len, size_t m, const float* tw, float sgn);
+
+/* twiddle free out-of-place pass over k = k..kend-1 reading x with a stride, see FFT10_DEFINE_COLS */
+typedef size_t (*fft10_cols_fn)(const float* x, size_t xs, float* y, size_t m, size_t k, size_t kend, float sgn);
+
+/* gather of kstep transforms into the layout of the batch functions, see KNAME(gather) */
+typedef void (*fft10_gather_fn)(const float* x, size_t xs, size_t xd, const size_t* idx,
+                                float* y, size_t i0, size_t i1);
+
+typedef struct {
+    int              isa;
+    size_t           kstep;      // complex values per vector
+    fft10_pass_fn    pass[11];   // indexed by the radix
+    fft10_batch_fn   batch[11];
+    fft10_cols_fn    cols10;
+    fft10_gather_fn  gather;
+} fft10_kernel_set;
+
+#ifdef FFT10_HAVE_X86_SIMD
+extern const fft10_kernel_set fft10_kernels_sse2;
+extern const fft10_kernel_set fft10_kernels_avx2;
+extern const fft10_kernel_set fft10_kernels_avx512;
+#endif
+
+/* kernels (fft10_kernels.c) */
+void fft10_leaf(const fft10_plan* plan, const float* in, size_t in_stride, float* out);
+void fft10_codelet(const fft10_plan* plan, const float* in, size_t in_stride, float* out);
+void fft10_pass(const fft10_plan* plan, int s, float* x);
+void fft10_pass_range(const fft10_plan* plan, int s, float* x, size_t k0, size_t k1);
+size_t fft10_batch_width(int isa);
+void fft10_batch_gather(const fft10_plan* plan, int isa, const float* x, size_t xs, size_t xd,
+                        float* buf, size_t i0, size_t i1);
+void fft10_batch_stages(const fft10_plan* plan, int isa, float* x, size_t len, int s0, int s1);
+
+/* thread pool (fft10_threads.c) */
+typedef void (*fft10_task_fn)(void* arg, size_t i);
+
+void fft10_parallel_for(size_t count, fft10_task_fn fn, void* arg);
+void fft10_pass_parallel(const fft10_plan* plan, int s, float* x);
+
+/* planner (fft10_plan.c, fft10_tune.c) */
+int         fft10_factor(size_t n, unsigned variant, fft10_shape* shape);
+fft10_plan* fft10_plan_build(size_t n, unsigned flags, const fft10_shape* shape);
+void        fft10_plan_free(fft10_plan* plan);
+fft10_plan* fft10_tune_build(size_t n, unsigned flags);
+
+/* engines; work is scratch of fft10_work_size floats, or NULL to allocate it per call */
+size_t fft10_work_size(const fft10_plan* plan, int in_place);
+int  fft10_execute_work(const fft10_plan* plan, const float* in, float* out, float* work);
+void fft10_execute_strided(const fft10_plan* plan, const float* in, size_t in_stride, float* out);
+void fft10_execute_iterative(const fft10_plan* plan, const float* in, float* out, float* work);
+void fft10_digit_reversal(const fft10_plan* plan, size_t* rev);
+void fft10_execute_stages(const fft10_plan* plan, float* x);
+
+/* double and fixed point plans (fft10_precision.c) */
+int fft10_precision_init(fft10_plan* plan, size_t total);
+
+/* Bluestein (fft10_bluestein.c) */
+fft10_bluestein* fft10_bluestein_create(size_t n, float sgn, float scale);
+void             fft10_bluestein_destroy(fft10_bluestein* blue);
+size_t           fft10_bluestein_work_size(const fft10_bluestein* blue);
+void             fft10_bluestein_execute(const fft10_bluestein* blue, const float* in, size_t in_stride, float* out,
+                                         float* work);
+size_t           fft10_next_smooth(size_t n);
+
+/* real transforms (fft10_real.c) */
+fft10_real* fft10_real_create(size_t n, unsigned flags);
+void        fft10_real_destroy(fft10_real* real);
+size_t      fft10_real_work_size(const fft10_real* real);
+void        fft10_real_r2c(const fft10_real* real, const float* in, float* out, float* work);
+void        fft10_real_c2r(const fft10_real* real, const float* in, float* out, float* work);
+void        fft10_real_post(const fft10_real* real, float* out);
+const fft10_plan* fft10_real_half(const fft10_real* real);
+
+#endif
@@ -0,0 +1,289 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_iterative.c
+ * Description: Iterative mixed radix engine. The input is brought into digit
+ * reversed order first, after which every stage works in place on contiguous
+ * data. Stages are blocked: all stages that fit into FFT10_BLOCK_BYTES are run
+ * on one block before the next block is touched, so the working set of those
+ * passes stays in cache.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - implement blocked iterative engine with in-place mode
+ * 18.10.2026 - run the permutation and large blocks on the thread pool
+ * 18.10.2026 - mixed radix stages, scratch copy for non palindromic plans
+ * 18.10.2026 - export the digit reversal table for the batch engine
+ * 18.10.2026 - export the stages alone for callers that permute on load
+ * 18.10.2026 - permute small plans through their digit reversal table
+ * 18.10.2026 - profile probes on the permutation and the leaves
+ * 18.10.2026 - scratch copy may come from the caller
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Digit t of an index has the base radix[t]. If the radix sequence of the plan
+ * is a palindrome, reversing the digits twice gives the index back and the
+ * in-place permutation is a sequence of swaps that needs no extra buffer.
+ * Other plans copy the input to a scratch buffer and gather from there.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "fft10_internal.h"
+
+/*
+ * Visits the indices i0..i1-1 in order while keeping j = digit reversal of i.
+ * If in == out pairs are swapped (palindromic plans only), otherwise
+ * out[i] = in[rev(i)] is gathered.
+ * Every swapped pair belongs to the range holding its smaller index, so
+ * disjoint ranges can run concurrently.
+ */
+static void digit_reverse(const fft10_plan* plan, const float* in, float* out, size_t i0, size_t i1) {
+    int     digit[FFT10_MAX_STAGES];
+    size_t  weight[FFT10_MAX_STAGES];
+    size_t  n = plan->n;
+    size_t  j = 0;
+    size_t  rest = i0;
+    int     s;
+    FFT10_PROF_BEGIN(t);
+
+    // small plans carry the permutation as a table
+    if(plan->rev)
+    {
+        const size_t* rev = plan->rev;
+        for(size_t i = i0; i < i1; i++)
+        {
+            j = rev[i];
+            if(in != out)
+            {
+                out[2*i]   = in[2*j];
+                out[2*i+1] = in[2*j+1];
+            }
+            else if(i < j)
+            {
+                float re = out[2*i], im = out[2*i+1];
+                out[2*i]   = out[2*j];
+                out[2*i+1] = out[2*j+1];
+                out[2*j]   = re;
+                out[2*j+1] = im;
+            }
+        }
+        FFT10_PROF_END(t, FFT10_PROFILE_PERMUTE, 0, -1, 1, (i1-i0)*(4*sizeof(float) + sizeof(size_t)));
+        return;
+    }
+
+    // weight[t] is the value of the t-th digit of i in the reversed index
+    for(s = 0; s < plan->nstages; s++)
+    {
+        weight[s] = n/plan->span[s];
+        digit[s]  = (int)(rest % (size_t)plan->radix[s]);
+        rest     /= (size_t)plan->radix[s];
+        j        += (size_t)digit[s]*weight[s];
+    }
+
+    for(size_t i = i0; i < i1; i++)
+    {
+        if(in == out)
+        {
+            if(i < j)
+            {
+                float re = out[2*i], im = out[2*i+1];
+                out[2*i]   = out[2*j];
+                out[2*i+1] = out[2*j+1];
+                out[2*j]   = re;
+                out[2*j+1] = im;
+            }
+        }
+        else
+        {
+            out[2*i]   = in[2*j];
+            out[2*i+1] = in[2*j+1];
+        }
+
+        // increment i by one, carrying through the digits of the reversed index
+        for(s = 0; s < plan->nstages; s++)
+        {
+            j += weight[s];
+            if(++digit[s] < plan->radix[s])
+            {
+                break;
+            }
+            digit[s] = 0;
+            j -= (size_t)plan->radix[s]*weight[s];
+        }
+    }
+    FFT10_PROF_END(t, FFT10_PROFILE_PERMUTE, 0, -1, 1, (i1-i0)*4*sizeof(float));
+}
+
+/*
+ * Fills rev[i] with the digit reversal of i, i = 0..n-1, so that the iterative
+ * stages can run on x[i] = in[rev[i]].
+ */
+void fft10_digit_reversal(const fft10_plan* plan, size_t* rev) {
+    int     digit[FFT10_MAX_STAGES] = {0};
+    size_t  j = 0;
+    int     s;
+
+    for(size_t i = 0; i < plan->n; i++)
+    {
+        rev[i] = j;
+        for(s = 0; s < plan->nstages; s++)
+        {
+            j += plan->n/plan->span[s];
+            if(++digit[s] < plan->radix[s])
+            {
+                break;
+            }
+            digit[s] = 0;
+            j -= (size_t)plan->radix[s]*(plan->n/plan->span[s]);
+        }
+    }
+}
+
+typedef struct {
+    const fft10_plan*  plan;
+    const float*       in;
+    float*             out;
+    size_t             chunk;
+} reverse_args;
+
+static void reverse_task(void* arg, size_t c) {
+    reverse_args* a  = (reverse_args*)arg;
+    size_t        i0 = c*a->chunk;
+    size_t        i1 = i0 + a->chunk < a->plan->n ? i0 + a->chunk : a->plan->n;
+
+    digit_reverse(a->plan, a->in, a->out, i0, i1);
+}
+
+typedef struct {
+    const fft10_plan*  plan;
+    float*             x;
+    int                s;
+} stages_args;
+
+static void run_stages(const fft10_plan* plan, float* x, int s);
+
+static void stages_task(void* arg, size_t r) {
+    stages_args* a = (stages_args*)arg;
+
+    run_stages(a->plan, a->x + 2*r*(a->plan->span[a->s]/(size_t)a->plan->radix[a->s]), a->s-1);
+}
+
+/*
+ * Runs stages 0..s on the span[s] values at x. Blocks larger than
+ * FFT10_BLOCK_BYTES are split into their radix[s] sub-blocks first (depth
+ * first), the remaining stages of a block that fits are run breadth first.
+ * Sub-blocks of blocks above FFT10_THREAD_CUTOFF points run on the thread pool.
+ */
+static void run_stages(const fft10_plan* plan, float* x, int s) {
+    size_t len   = plan->span[s];
+    size_t radix = (size_t)plan->radix[s];
+
+    if(len*2*sizeof(float) > FFT10_BLOCK_BYTES && s > 0)
+    {
+        size_t m = len/radix;
+        if(len >= FFT10_THREAD_CUTOFF && fft10_get_threads() > 1)
+        {
+            stages_args a = { plan, x, s };
+            fft10_parallel_for(radix, stages_task, &a);
+            fft10_pass_parallel(plan, s, x);
+            return;
+        }
+        for(size_t r = 0; r < radix; r++)
+        {
+            run_stages(plan, x + 2*r*m, s-1);
+        }
+        fft10_pass(plan, s, x);
+        return;
+    }
+
+    FFT10_PROF_BEGIN(leaves);
+    for(size_t off = 0; off < len; off += (size_t)plan->radix[0])
+    {
+        fft10_leaf(plan, x + 2*off, 1, x + 2*off);
+    }
+    FFT10_PROF_END(leaves, FFT10_PROFILE_LEAF, plan->radix[0], -1, len/(size_t)plan->radix[0], len*4*sizeof(float));
+    for(int t = 1; t <= s; t++)
+    {
+        size_t span = plan->span[t];
+        for(size_t off = 0; off < len; off += span)
+        {
+            fft10_pass(plan, t, x + 2*off);
+        }
+    }
+}
+
+/*
+ * Runs every stage of plan in place on x, which already holds the input in
+ * digit reversed order (see fft10_digit_reversal). Callers that permute the
+ * input while loading it from elsewhere use this to skip the copy.
+ */
+void fft10_execute_stages(const fft10_plan* plan, float* x) {
+    if(plan->nstages > 0)
+    {
+        run_stages(plan, x, plan->nstages-1);
+    }
+}
+
+/*
+ * Function: fft10_execute_iterative
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Computes the transform of plan with the iterative engine. in may be equal
+ *     to out, in which case no memory besides the data itself is used if the
+ *     plan is palindromic; other plans need a scratch copy of the input, taken
+ *     from work (2*n floats) or allocated if work is NULL.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_execute_iterative(const fft10_plan* plan, const float* in, float* out, float* work) {
+    int     nthreads = fft10_get_threads();
+    float*  scratch  = NULL;
+
+    if(in == out && !plan->palindromic)
+    {
+        if(!work)
+        {
+            work = scratch = (float*)malloc(2*plan->n*sizeof(float));
+            if(!scratch)
+            {
+                return;
+            }
+        }
+        memcpy(work, in, 2*plan->n*sizeof(float));
+        in = work;
+    }
+
+    if(plan->n >= FFT10_THREAD_CUTOFF && nthreads > 1)
+    {
+        reverse_args a = { plan, in, out, 0 };
+        a.chunk = (plan->n + 4*(size_t)nthreads-1)/(4*(size_t)nthreads);
+        fft10_parallel_for((plan->n + a.chunk-1)/a.chunk, reverse_task, &a);
+    }
+    else
+    {
+        digit_reverse(plan, in, out, 0, plan->n);
+    }
+    free(scratch);
+
+    if(plan->nstages > 0)
+    {
+        run_stages(plan, out, plan->nstages-1);
+    }
+}
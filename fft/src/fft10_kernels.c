@@ -0,0 +1,380 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_kernels.c
+ * Description: Butterfly kernels shared by the recursive and the iterative
+ * engine of the fft, and the runtime selection of the instruction set
+ * used by them.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - move the radix10 butterflies out of fft10_plan.c
+ * 18.10.2026 - scalar kernels come from fft10_butterflies.inc, dispatch to the
+ *              SIMD kernels of fft10_simd.c
+ * 18.10.2026 - dispatch on the radix of the stage (2, 3, 4, 5, 8, 10)
+ * 18.10.2026 - batch kernels running one transform per vector lane
+ * 18.10.2026 - leaves apply the 1/n of backward plans
+ * 18.10.2026 - unrolled 10, 100 and 1000 point codelets with constant twiddle tables
+ * 18.10.2026 - kernel source is generic in the element type (KREAL)
+ * 18.10.2026 - profile probes on passes and batch stages
+ * 18.10.2026 - codelets read strided input without a copy
+ * 18.10.2026 - batch stages run on a range of stages and points, vector gather
+ *              of the batch layout
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * The kernels read all values of a butterfly before writing any of them, so they
+ * may run in place. The instruction set is detected on first use and can
+ * be overridden with the environment variable FFT10_ISA (scalar, sse2, avx2,
+ * avx512) or with fft10_set_isa.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "fft10_internal.h"
+#include "fft10_codelets.inc"
+
+/* scalar instantiation of the butterflies, one complex value per vector */
+typedef struct { float re, im; } fft10_cf;
+
+static inline fft10_cf cf_ld(const float* p)             { fft10_cf v = { p[0], p[1] }; return v; }
+static inline void     cf_st(float* p, fft10_cf v)       { p[0] = v.re; p[1] = v.im; }
+static inline fft10_cf cf_set(float re, float im)        { fft10_cf v = { re, im }; return v; }
+static inline fft10_cf cf_add(fft10_cf a, fft10_cf b)    { fft10_cf v = { a.re + b.re, a.im + b.im }; return v; }
+static inline fft10_cf cf_sub(fft10_cf a, fft10_cf b)    { fft10_cf v = { a.re - b.re, a.im - b.im }; return v; }
+static inline fft10_cf cf_mul(fft10_cf a, fft10_cf b)    { fft10_cf v = { a.re*b.re - a.im*b.im, a.im*b.re + a.re*b.im }; return v; }
+static inline fft10_cf cf_scale(fft10_cf a, float c)     { fft10_cf v = { a.re*c, a.im*c }; return v; }
+static inline fft10_cf cf_madd(fft10_cf a, fft10_cf b, float c) { fft10_cf v = { a.re + b.re*c, a.im + b.im*c }; return v; }
+static inline fft10_cf cf_mulnj(fft10_cf a)              { fft10_cf v = { a.im, -a.re }; return v; }
+
+#define KREAL           float
+#define CV              fft10_cf
+#define KSTEP           1
+#define KNAME(name)     name##_scalar
+#define KATTR
+#define CV_LD(p)        cf_ld(p)
+#define CV_ST(p, v)     cf_st(p, v)
+#define CV_LDT(p)       cf_ld(p)
+#define CV_LDS(p, s)    cf_ld(p)
+#define CV_SET(re, im)  cf_set(re, im)
+#define CV_ADD(a, b)    cf_add(a, b)
+#define CV_SUB(a, b)    cf_sub(a, b)
+#define CV_MUL(a, b)    cf_mul(a, b)
+#define CV_SCALE(a, c)  cf_scale(a, c)
+#define CV_MADD(a, b, c) cf_madd(a, b, c)
+#define CV_MULNJ(a)     cf_mulnj(a)
+#include "fft10_butterflies.inc"
+
+static const fft10_kernel_set kernels_scalar = {
+    FFT10_ISA_SCALAR,
+    1,
+    { NULL, NULL, pass2_scalar, pass3_scalar, pass4_scalar, pass5_scalar, NULL, NULL, pass8_scalar, NULL, pass10_scalar },
+    { NULL, NULL, batch2_scalar, batch3_scalar, batch4_scalar, batch5_scalar, NULL, NULL, batch8_scalar, NULL, batch10_scalar },
+    cols10_scalar,
+    gather_scalar
+};
+
+/* best instruction set supported by the cpu, and the one currently in use */
+static int isa_supported = -1;
+static int isa_active    = -1;
+
+static const fft10_kernel_set* kernel_set(int isa) {
+    switch(isa)
+    {
+#ifdef FFT10_HAVE_X86_SIMD
+    case FFT10_ISA_SSE2:   return &fft10_kernels_sse2;
+    case FFT10_ISA_AVX2:   return &fft10_kernels_avx2;
+    case FFT10_ISA_AVX512: return &fft10_kernels_avx512;
+#endif
+    default:               return &kernels_scalar;
+    }
+}
+
+static void isa_init(void) {
+    const char* env;
+    int         isa = FFT10_ISA_SCALAR;
+
+    if(isa_supported >= 0)
+    {
+        return;
+    }
+#ifdef FFT10_HAVE_X86_SIMD
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("sse2"))
+    {
+        isa = FFT10_ISA_SSE2;
+    }
+    if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    {
+        isa = FFT10_ISA_AVX2;
+    }
+    if(__builtin_cpu_supports("avx512f"))
+    {
+        isa = FFT10_ISA_AVX512;
+    }
+#endif
+    isa_supported = isa;
+
+    env = getenv("FFT10_ISA");
+    if(env)
+    {
+        if(!strcmp(env, "scalar"))      isa = FFT10_ISA_SCALAR;
+        else if(!strcmp(env, "sse2"))   isa = FFT10_ISA_SSE2;
+        else if(!strcmp(env, "avx2"))   isa = FFT10_ISA_AVX2;
+        else if(!strcmp(env, "avx512")) isa = FFT10_ISA_AVX512;
+        if(isa > isa_supported)
+        {
+            isa = isa_supported;
+        }
+    }
+    isa_active = isa;
+}
+
+/*
+ * Function: fft10_get_isa
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Returns the instruction set (FFT10_ISA_*) used by the butterfly kernels.
+ *
+ * ----------------------------------------------------------------------------
+ */
+int fft10_get_isa(void) {
+    isa_init();
+    return isa_active;
+}
+
+/*
+ * Function: fft10_set_isa
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Selects the instruction set used by the butterfly kernels, e.g.
+ *     FFT10_ISA_SCALAR to check the SIMD kernels against the scalar ones.
+ *
+ * Parameters:
+ *     int isa:
+ *         One of FFT10_ISA_SCALAR, FFT10_ISA_SSE2, FFT10_ISA_AVX2, FFT10_ISA_AVX512.
+ *
+ * Returns:
+ *     The instruction set in use afterwards; requests above what the cpu
+ *     supports are lowered to the best supported one.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Must not be called while transforms are running in other threads.
+ *
+ * ----------------------------------------------------------------------------
+ */
+int fft10_set_isa(int isa) {
+    isa_init();
+    if(isa < FFT10_ISA_SCALAR)
+    {
+        isa = FFT10_ISA_SCALAR;
+    }
+    if(isa > isa_supported)
+    {
+        isa = isa_supported;
+    }
+    isa_active = isa;
+    return isa_active;
+}
+
+/*
+ * Leaf of the recursion: DFT of radix complex values read with stride in_stride
+ * (in complex elements), written contiguously to out. in may be equal to out.
+ */
+void fft10_leaf(const fft10_plan* plan, const float* in, size_t in_stride, float* out) {
+    int       radix = plan->radix[0];
+    float     sgn   = plan->sgn;
+    fft10_cf  v[10];
+
+    for(int r = 0; r < radix; r++)
+    {
+        v[r] = cf_ld(in + 2*(size_t)r*in_stride);
+    }
+    if(plan->scale != 1.0f)
+    {
+        for(int r = 0; r < radix; r++)
+        {
+            v[r] = cf_scale(v[r], plan->scale);
+        }
+    }
+    switch(radix)
+    {
+    case 2:  dft2_scalar(v, sgn);  break;
+    case 3:  dft3_scalar(v, sgn);  break;
+    case 4:  dft4_scalar(v, sgn);  break;
+    case 5:  dft5_scalar(v, sgn);  break;
+    case 8:  dft8_scalar(v, sgn);  break;
+    default: dft10_scalar(v, sgn); break;
+    }
+    for(int r = 0; r < radix; r++)
+    {
+        cf_st(out + 2*r, v[r]);
+    }
+}
+
+/*
+ * Radix radix combine pass over k = k0..k1-1 with the twiddle table tw. The
+ * widest kernel runs first, the k it leaves over are handed down to the
+ * narrower ones.
+ */
+static void pass_cascade(int radix, float* x, size_t m, const float* tw, size_t k0, size_t k1, float sgn) {
+    size_t k = k0;
+
+    for(int isa = isa_active; isa > FFT10_ISA_SCALAR; isa--)
+    {
+        k = kernel_set(isa)->pass[radix](x, m, tw, k, k1, sgn);
+    }
+    kernels_scalar.pass[radix](x, m, tw, k, k1, sgn);
+}
+
+/*
+ * Combine pass of stage s of plan on the span[s] values at x, restricted to
+ * k = k0..k1-1: element k of sub-transform r is multiplied by the twiddle
+ * W_span^(r*k) and the radix values of every k are replaced by their DFT.
+ */
+void fft10_pass_range(const fft10_plan* plan, int s, float* x, size_t k0, size_t k1) {
+    int radix = plan->radix[s];
+    FFT10_PROF_BEGIN(t);
+
+    pass_cascade(radix, x, plan->span[s]/(size_t)radix, plan->tw[s], k0, k1, plan->sgn);
+    // per k radix values read and written and radix-1 twiddles read
+    FFT10_PROF_END(t, FFT10_PROFILE_PASS, radix, s, 1, (k1-k0)*(size_t)(6*radix-2)*sizeof(float));
+}
+
+void fft10_pass(const fft10_plan* plan, int s, float* x) {
+    fft10_pass_range(plan, s, x, 0, plan->span[s]/(size_t)plan->radix[s]);
+}
+
+size_t fft10_batch_width(int isa) {
+    return kernel_set(isa)->kstep;
+}
+
+/*
+ * Gathers positions i0..i1-1 of the digit reversed order of plan for the
+ * fft10_batch_width(isa) transforms at x, element j of transform b read from
+ * x[2*(j*xs + b*xd)], into the side by side layout of fft10_batch_stages.
+ */
+void fft10_batch_gather(const fft10_plan* plan, int isa, const float* x, size_t xs, size_t xd,
+                        float* buf, size_t i0, size_t i1) {
+    kernel_set(isa)->gather(x, xs, xd, plan->rev, buf, i0, i1);
+}
+
+/*
+ * Runs stages s0..s1-1 of plan on the first len points of fft10_batch_width(isa)
+ * transforms stored side by side at x in digit reversed order, using the
+ * kernels of isa. len is plan->n or a multiple of the span of stage s1-1.
+ */
+void fft10_batch_stages(const fft10_plan* plan, int isa, float* x, size_t len, int s0, int s1) {
+    const fft10_kernel_set* ks = kernel_set(isa);
+
+    for(int s = s0; s < s1; s++)
+    {
+        int radix = plan->radix[s];
+        FFT10_PROF_BEGIN(t);
+        ks->batch[radix](x, len, plan->span[s]/(size_t)radix, plan->tw[s], plan->sgn);
+        FFT10_PROF_END(t, FFT10_PROFILE_BATCH, radix, -1, 1, len*ks->kstep*4*sizeof(float));
+    }
+}
+
+/*
+ * Codelets: the first one, two or three radix 10 stages of a plan as one call
+ * with fixed trip counts and the twiddles of fft10_codelets.inc. Their result
+ * is the conjugate of the transform for backward plans, which fft10_codelet
+ * undoes at the end, so one forward table serves both directions.
+ */
+static inline void codelet10(const float* in, size_t s, float* out, float scale, float conj) {
+    fft10_cf v[10];
+
+    for(size_t j = 0; j < 10; j++)
+    {
+        v[j] = cf_set(in[2*j*s]*scale, in[2*j*s+1]*conj);
+    }
+    dft10_scalar(v, 1.0f);
+    for(size_t j = 0; j < 10; j++)
+    {
+        cf_st(out + 2*j, v[j]);
+    }
+}
+
+/* column pass of the codelets reading x with stride xs, widest kernel first */
+static void cols_cascade(const float* x, size_t xs, float* y, size_t m, float sgn) {
+    size_t k = 0;
+
+    for(int isa = isa_active; isa > FFT10_ISA_SCALAR; isa--)
+    {
+        k = kernel_set(isa)->cols10(x, xs, y, m, k, m, sgn);
+    }
+    kernels_scalar.cols10(x, xs, y, m, k, m, sgn);
+}
+
+/*
+ * 100 points as a 10 x 10 matrix x[10*j1 + j2] read with stride s: the column
+ * DFTs over j1 run side by side in vectors in the direction of the plan. The
+ * transposed result, scaled and conjugated for backward plans, is the input
+ * of the forward radix 10 pass with the twiddles W_100^(j2*k1), which leaves
+ * X in natural order.
+ */
+static void codelet100(const float* in, size_t s, float* out, float scale, float sgn) {
+    float y[2*100];
+    float conj = sgn*scale;
+
+    cols_cascade(in, s, y, 10, sgn);
+
+    for(size_t k1 = 0; k1 < 10; k1++)
+    {
+        for(size_t j2 = 0; j2 < 10; j2++)
+        {
+            out[2*(10*j2 + k1)]   = y[2*(10*k1 + j2)]*scale;
+            out[2*(10*j2 + k1)+1] = y[2*(10*k1 + j2)+1]*conj;
+        }
+    }
+    pass_cascade(10, out, 10, fft10_tw100, 0, 10, 1.0f);
+}
+
+static void codelet1000(const float* in, size_t s, float* out, float scale, float sgn) {
+    for(size_t r = 0; r < 10; r++)
+    {
+        codelet100(in + 2*r*s, 10*s, out + 2*100*r, scale, sgn);
+    }
+    pass_cascade(10, out, 100, fft10_tw1000, 0, 100, 1.0f);
+}
+
+/*
+ * Stages 0..plan->codelet-1 of plan on the span[codelet-1] values read from
+ * in with stride in_stride, written contiguously to out (no overlap).
+ */
+void fft10_codelet(const fft10_plan* plan, const float* in, size_t in_stride, float* out) {
+    size_t  len  = plan->span[plan->codelet-1];
+
+    switch(plan->codelet)
+    {
+    case 1:  codelet10(in, in_stride, out, plan->scale, plan->sgn*plan->scale);  break;
+    case 2:  codelet100(in, in_stride, out, plan->scale, plan->sgn);            break;
+    default: codelet1000(in, in_stride, out, plan->scale, plan->sgn);           break;
+    }
+    if(plan->sgn < 0.0f)
+    {
+        for(size_t i = 0; i < len; i++)
+        {
+            out[2*i+1] = -out[2*i+1];
+        }
+    }
+}
@@ -0,0 +1,458 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_nd.c
+ * Description: Multidimensional (2D/3D) transforms of row-major arrays, complex
+ * or real input. The contiguous last axis is one batch of row transforms; every
+ * other axis is transformed through tiled transposes: a tile of neighbouring
+ * columns is copied into a contiguous panel, transformed as a batch and copied
+ * back, so no transform ever walks the array with the stride of a row or plane.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - add 2D/3D complex and real transforms
+ *
+ * ----------------------------------------------------------------------------
+ * Usage:
+ * ----------------------------------------------------------------------------
+ *     // range-Doppler map of 256 pulses of 1000 complex samples
+ *     size_t    dims[2] = { 256, 1000 };
+ *     fft10_nd* p = fft10_nd_create(2, dims, FFT10_ESTIMATE);
+ *     fft10_nd_execute(p, cube, map);
+ *     fft10_nd_destroy(p);
+ *
+ *     // real image of 480 x 640 pixels, 480 x 321 complex bins
+ *     size_t    size[2] = { 480, 640 };
+ *     fft10_nd* r = fft10_nd_create(2, size, FFT10_REAL);
+ *     fft10_nd_execute_r2c(r, image, spectrum);
+ *     fft10_nd_execute_c2r(r, spectrum, image);
+ *     fft10_nd_destroy(r);
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * An axis of length len with stride complex values between its elements splits
+ * the array into blocks of len x stride values. Tile t of a block holds the
+ * columns t*ND_TILE.. of it; every row of a tile is a run of ND_TILE complex
+ * values (two cache lines), so a pass over an axis streams whole lines through
+ * the cache whatever the stride is. Axes short enough for the lane parallel
+ * batch engine (plans with rev) are handed to fft10_execute_many directly with
+ * the stride of the axis: its gather of FFT10_BATCH_LANES neighbouring columns
+ * already is the transpose of a tile. Longer axes are copied into a panel of
+ * ND_TILE contiguous transforms first.
+ *
+ * Tiles are split over the thread pool across blocks (planes of a 3D array) and
+ * across the columns of a block. The tile boundaries do not depend on the number
+ * of threads, so the results are the same for every thread count.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "fft10_internal.h"
+
+/* columns of an axis moved through a panel at once */
+#define ND_TILE  16
+
+struct fft10_nd {
+    int          rank;
+    unsigned     flags;
+    size_t       dims[FFT10_ND_MAX_RANK];
+    size_t       cdims[FFT10_ND_MAX_RANK];   // the complex array, n/2+1 on the last axis of real transforms
+    size_t       total;                      // complex values of the complex array
+    fft10_plan*  fwd[FFT10_ND_MAX_RANK];     // FFT10_REAL plan on the last axis of real transforms
+    fft10_plan*  bwd[FFT10_ND_MAX_RANK];     // real transforms: backward plans of the other axes
+};
+
+typedef struct {
+    const fft10_plan*  plan;
+    const float*       src;
+    float*             dst;
+    size_t             len;       // length of the axis
+    size_t             stride;    // complex values between two elements of the axis
+    size_t             tiles;     // tiles per block
+    size_t             count;     // tiles of all blocks
+    size_t             chunk;     // tiles per task
+} axis_args;
+
+typedef struct {
+    const fft10_plan*  plan;
+    const float*       src;
+    size_t             src_dist;  // floats between two rows of src
+    float*             dst;
+    size_t             dst_dist;
+    size_t             count;     // rows
+    size_t             chunk;     // rows per task
+    int                inverse;
+} rows_args;
+
+/* items per task for count items covering points values, everything in one task below the cutoff */
+static size_t nd_chunk(size_t count, size_t points) {
+    size_t nthreads = (size_t)fft10_get_threads();
+
+    if(nthreads <= 1 || points < FFT10_THREAD_CUTOFF)
+    {
+        return count;
+    }
+    return (count + 4*nthreads-1)/(4*nthreads);
+}
+
+/* tiles c*chunk.. of an axis, transposed into a panel unless the batch engine reads them in place */
+static void axis_task(void* arg, size_t c) {
+    axis_args*  a     = (axis_args*)arg;
+    size_t      t0    = c*a->chunk;
+    size_t      t1    = t0 + a->chunk < a->count ? t0 + a->chunk : a->count;
+    size_t      len   = a->len;
+    size_t      width = a->stride < ND_TILE ? a->stride : ND_TILE;
+    float*      panel = NULL;
+    float*      spec  = NULL;
+
+    if(!a->plan->rev)
+    {
+        // gathered columns and their transforms, out of place for the recursive engine
+        panel = (float*)malloc(4*width*len*sizeof(float));
+        if(!panel)
+        {
+            return;
+        }
+        spec = panel + 2*width*len;
+    }
+
+    for(size_t t = t0; t < t1; t++)
+    {
+        size_t        c0  = (t % a->tiles)*ND_TILE;
+        size_t        w   = c0 + ND_TILE < a->stride ? ND_TILE : a->stride - c0;
+        size_t        off = 2*((t / a->tiles)*len*a->stride + c0);
+        const float*  s   = a->src + off;
+        float*        d   = a->dst + off;
+
+        if(!panel)
+        {
+            fft10_execute_many(a->plan, w, s, a->stride, 1, d, a->stride, 1);
+            continue;
+        }
+
+        for(size_t r = 0; r < len; r++)
+        {
+            const float* row = s + 2*r*a->stride;
+            for(size_t q = 0; q < w; q++)
+            {
+                panel[2*(q*len + r)]   = row[2*q];
+                panel[2*(q*len + r)+1] = row[2*q+1];
+            }
+        }
+        fft10_execute_many(a->plan, w, panel, 1, len, spec, 1, len);
+        for(size_t r = 0; r < len; r++)
+        {
+            float* row = d + 2*r*a->stride;
+            for(size_t q = 0; q < w; q++)
+            {
+                row[2*q]   = spec[2*(q*len + r)];
+                row[2*q+1] = spec[2*(q*len + r)+1];
+            }
+        }
+    }
+    free(panel);
+}
+
+/* transforms along axis d of the complex array from src to dst, src may be dst */
+static void nd_axis(const fft10_nd* nd, const fft10_plan* plan, int d, const float* src, float* dst) {
+    axis_args  a;
+    size_t     blocks = 1;
+
+    a.plan   = plan;
+    a.src    = src;
+    a.dst    = dst;
+    a.len    = nd->cdims[d];
+    a.stride = 1;
+    for(int i = 0; i < d; i++)
+    {
+        blocks *= nd->cdims[i];
+    }
+    for(int i = d+1; i < nd->rank; i++)
+    {
+        a.stride *= nd->cdims[i];
+    }
+
+    // the contiguous axis: rows, batched and threaded by fft10_execute_many
+    if(a.stride == 1)
+    {
+        fft10_execute_many(plan, blocks, src, 1, a.len, dst, 1, a.len);
+        return;
+    }
+
+    a.tiles = (a.stride + ND_TILE-1)/ND_TILE;
+    a.count = blocks*a.tiles;
+    a.chunk = nd_chunk(a.count, nd->total);
+    fft10_parallel_for((a.count + a.chunk-1)/a.chunk, axis_task, &a);
+}
+
+/* rows c*chunk.. of a real transform */
+static void rows_task(void* arg, size_t c) {
+    rows_args*  a  = (rows_args*)arg;
+    size_t      r0 = c*a->chunk;
+    size_t      r1 = r0 + a->chunk < a->count ? r0 + a->chunk : a->count;
+
+    for(size_t r = r0; r < r1; r++)
+    {
+        if(a->inverse)
+        {
+            fft10_execute_c2r(a->plan, a->src + r*a->src_dist, a->dst + r*a->dst_dist);
+        }
+        else
+        {
+            fft10_execute_r2c(a->plan, a->src + r*a->src_dist, a->dst + r*a->dst_dist);
+        }
+    }
+}
+
+/* real transforms of the rows: n real values to n/2+1 bins, or back */
+static void nd_rows(const fft10_nd* nd, const float* src, float* dst, int inverse) {
+    rows_args  a;
+    size_t     n = nd->dims[nd->rank-1];
+    size_t     h = nd->cdims[nd->rank-1];
+
+    a.plan     = nd->fwd[nd->rank-1];
+    a.src      = src;
+    a.src_dist = inverse ? 2*h : n;
+    a.dst      = dst;
+    a.dst_dist = inverse ? n : 2*h;
+    a.count    = nd->total/h;
+    a.inverse  = inverse;
+    a.chunk    = nd_chunk(a.count, nd->total);
+    fft10_parallel_for((a.count + a.chunk-1)/a.chunk, rows_task, &a);
+}
+
+void fft10_nd_destroy(fft10_nd* nd) {
+    if(!nd)
+    {
+        return;
+    }
+    for(int d = 0; d < nd->rank; d++)
+    {
+        fft10_plan_destroy(nd->fwd[d]);
+        fft10_plan_destroy(nd->bwd[d]);
+    }
+    free(nd);
+}
+
+/*
+ * Function: fft10_nd_create
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Creates a transform of a row-major array of rank dimensions, the last
+ *     one contiguous. Every axis is transformed with a plan of its length, so
+ *     all lengths fft10_plan_create accepts (including primes) are allowed.
+ *
+ * Parameters:
+ *     int rank:
+ *         Number of dimensions, 1 to FFT10_ND_MAX_RANK.
+ *     const size_t* dims:
+ *         Length of every dimension, dims[rank-1] is the contiguous one.
+ *     unsigned flags:
+ *         FFT10_ESTIMATE or FFT10_BACKWARD (normalized by 1/(n0*n1*..)), or
+ *         FFT10_REAL for fft10_nd_execute_r2c and fft10_nd_execute_c2r. The
+ *         planner flags FFT10_MEASURE, FFT10_RECURSIVE, FFT10_ITERATIVE and
+ *         FFT10_NO_CACHE are passed to the plans of the axes.
+ *
+ * Returns:
+ *     The transform, or NULL for a rank out of range, a zero length, double
+ *     or fixed point flags or if a plan could not be created.
+ *
+ * ----------------------------------------------------------------------------
+ */
+fft10_nd* fft10_nd_create(int rank, const size_t* dims, unsigned flags) {
+    fft10_nd* nd;
+    int       last = rank-1;
+
+    if(rank < 1 || rank > FFT10_ND_MAX_RANK || (flags & FFT10_PRECISION_MASK))
+    {
+        return NULL;
+    }
+    for(int d = 0; d < rank; d++)
+    {
+        if(dims[d] == 0)
+        {
+            return NULL;
+        }
+    }
+
+    nd = (fft10_nd*)calloc(1, sizeof(*nd));
+    if(!nd)
+    {
+        return NULL;
+    }
+    nd->rank  = rank;
+    nd->flags = flags;
+    nd->total = 1;
+    for(int d = 0; d < rank; d++)
+    {
+        nd->dims[d]  = dims[d];
+        nd->cdims[d] = (flags & FFT10_REAL) && d == last ? dims[d]/2 + 1 : dims[d];
+        nd->total   *= nd->cdims[d];
+    }
+
+    for(int d = 0; d < rank; d++)
+    {
+        if(!(flags & FFT10_REAL))
+        {
+            nd->fwd[d] = fft10_plan_create(dims[d], flags);
+        }
+        else if(d == last)
+        {
+            nd->fwd[d] = fft10_plan_create(dims[d], flags & ~FFT10_BACKWARD);
+        }
+        else
+        {
+            nd->fwd[d] = fft10_plan_create(dims[d], flags & ~(FFT10_REAL | FFT10_BACKWARD));
+            nd->bwd[d] = fft10_plan_create(dims[d], (flags & ~FFT10_REAL) | FFT10_BACKWARD);
+            if(!nd->bwd[d])
+            {
+                fft10_nd_destroy(nd);
+                return NULL;
+            }
+        }
+        if(!nd->fwd[d])
+        {
+            fft10_nd_destroy(nd);
+            return NULL;
+        }
+    }
+    return nd;
+}
+
+/*
+ * Function: fft10_nd_execute
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Complex transform of the whole array, all axes in the direction of the
+ *     flags. On FFT10_REAL transforms this is fft10_nd_execute_r2c.
+ *
+ * Parameters:
+ *     const fft10_nd* nd:
+ *         Transform returned by fft10_nd_create.
+ *     const float* in:
+ *         n0*n1*.. complex values as interleaved re/im, row-major.
+ *     float* out:
+ *         The result in the same layout, may be equal to in.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * The rows are transformed first (from in to out), then the other axes in
+ * place from the last to the first.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_nd_execute(const fft10_nd* nd, const float* in, float* out) {
+    int last = nd->rank-1;
+
+    if(nd->flags & FFT10_REAL)
+    {
+        fft10_nd_execute_r2c(nd, in, out);
+        return;
+    }
+
+    nd_axis(nd, nd->fwd[last], last, in, out);
+    for(int d = last-1; d >= 0; d--)
+    {
+        nd_axis(nd, nd->fwd[d], d, out, out);
+    }
+}
+
+/*
+ * Function: fft10_nd_execute_r2c
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Forward transform of a real array on a FFT10_REAL transform. Only the
+ *     bins 0..n/2 of the last axis are stored, the others are the conjugates
+ *     X[k0][k1][n-k] = conj(X[-k0][-k1][k]).
+ *
+ * Parameters:
+ *     const fft10_nd* nd:
+ *         Transform returned by fft10_nd_create with FFT10_REAL.
+ *     const float* in:
+ *         n0*..*n real values, row-major.
+ *     float* out:
+ *         n0*..*(n/2+1) complex values, row-major. Must not overlap in.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_nd_execute_r2c(const fft10_nd* nd, const float* in, float* out) {
+    if(!(nd->flags & FFT10_REAL))
+    {
+        return;
+    }
+
+    nd_rows(nd, in, out, 0);
+    for(int d = nd->rank-2; d >= 0; d--)
+    {
+        nd_axis(nd, nd->fwd[d], d, out, out);
+    }
+}
+
+/*
+ * Function: fft10_nd_execute_c2r
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Inverse of fft10_nd_execute_r2c, normalized by 1/(n0*n1*..) so that
+ *     fft10_nd_execute_c2r(fft10_nd_execute_r2c(x)) = x.
+ *
+ * Parameters:
+ *     const fft10_nd* nd:
+ *         Transform returned by fft10_nd_create with FFT10_REAL.
+ *     const float* in:
+ *         n0*..*(n/2+1) complex values, row-major. Not modified.
+ *     float* out:
+ *         n0*..*n real values, row-major. Must not overlap in.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * The axes other than the last are transformed into a scratch copy of the
+ * spectrum allocated by the call; without memory the call returns and out
+ * is unchanged.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_nd_execute_c2r(const fft10_nd* nd, const float* in, float* out) {
+    const float* src = in;
+    float*       work;
+
+    if(!(nd->flags & FFT10_REAL))
+    {
+        return;
+    }
+    if(nd->rank == 1)
+    {
+        fft10_execute_c2r(nd->fwd[0], in, out);
+        return;
+    }
+
+    work = (float*)malloc(2*nd->total*sizeof(float));
+    if(!work)
+    {
+        return;
+    }
+    for(int d = 0; d < nd->rank-1; d++)
+    {
+        nd_axis(nd, nd->bwd[d], d, src, work);
+        src = work;
+    }
+    nd_rows(nd, work, out, 1);
+    free(work);
+}
@@ -0,0 +1,652 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_plan.c
+ * Description: Plan based interface of the fft. A plan precomputes the
+ * twiddle table of every stage once, so executing a plan only loads twiddles
+ * instead of calling cosf/sinf in the butterfly loop. Plans are kept in a
+ * process-wide cache and reused by later requests for the same length.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - add plan/execute/destroy interface with cached twiddle tables
+ * 18.10.2026 - choose between the recursive and the iterative in-place engine
+ * 18.10.2026 - split large recursion levels over the thread pool
+ * 18.10.2026 - mixed radix 2/3/4/5/8/10 stages, Bluestein for other lengths
+ * 18.10.2026 - FFT10_REAL plans
+ * 18.10.2026 - normalized FFT10_BACKWARD plans, 1/n is applied at the leaves
+ * 18.10.2026 - leading radix 10 stages run on the codelets of fft10_kernels.c
+ * 18.10.2026 - FFT10_DOUBLE, FFT10_Q15 and FFT10_Q31 plans
+ * 18.10.2026 - plans of a given shape for the measuring planner (fft10_tune.c)
+ * 18.10.2026 - profile probes on leaves, codelets, twiddles and executions
+ * 18.10.2026 - fft10_execute returns -1 on double and fixed point plans
+ * 18.10.2026 - fft10_execute_work runs on scratch of the caller
+ *
+ * ----------------------------------------------------------------------------
+ * Usage:
+ * ----------------------------------------------------------------------------
+ *     fft10_plan* p = fft10_plan_create(1000, FFT10_ESTIMATE);
+ *     fft10_execute(p, x, X);
+ *     fft10_plan_destroy(p);
+ *
+ * ----------------------------------------------------------------------------
+ * Dependencies:
+ * ----------------------------------------------------------------------------
+ * Standard C Library, pthreads (unless compiled with FFT10_NO_THREADS)
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Plans are immutable after creation and may be executed from several threads
+ * at the same time.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "fft10_internal.h"
+
+// flags that change the content of a plan (and therefore the cache key)
+#define FFT10_PLAN_KEY_MASK  (FFT10_RECURSIVE | FFT10_ITERATIVE | FFT10_REAL | FFT10_BACKWARD | FFT10_BACKWARD_RAW | \
+                              FFT10_PRECISION_MASK | FFT10_MEASURE)
+
+static fft10_plan*  plan_cache      = NULL;
+static fft10_mutex  plan_cache_lock = FFT10_MUTEX_INITIALIZER;
+
+
+typedef struct {
+    const fft10_plan*  plan;
+    int                s;
+    const float*       in;
+    size_t             in_stride;
+    float*             out;
+} recursive_args;
+
+static void fft10_recursive(const fft10_plan* plan, int s, const float* in, size_t in_stride, float* out);
+
+/* records count leaves (or codelets) of level s, s = 0 or codelet-1, run since mark t */
+#define PROF_LEAVES(t, plan, s, count) \
+    FFT10_PROF_END(t, (s) == (plan)->codelet-1 ? FFT10_PROFILE_CODELET : FFT10_PROFILE_LEAF, \
+                   (s) == (plan)->codelet-1 ? (plan)->codelet : (plan)->radix[0], -1, \
+                   count, (count)*(plan)->span[s]*4*sizeof(float))
+
+static void recursive_task(void* arg, size_t r) {
+    recursive_args* a     = (recursive_args*)arg;
+    size_t          radix = (size_t)a->plan->radix[a->s];
+    size_t          m     = a->plan->span[a->s]/radix;
+
+    fft10_recursive(a->plan, a->s-1, a->in + 2*r*a->in_stride, radix*a->in_stride, a->out + 2*r*m);
+}
+
+static void fft10_recursive(const fft10_plan* plan, int s, const float* in, size_t in_stride, float* out) {
+    size_t radix = (size_t)plan->radix[s];
+
+    if(s == plan->codelet-1)
+    {
+        fft10_codelet(plan, in, in_stride, out);
+    }
+    else if(s == 0)
+    {
+        fft10_leaf(plan, in, in_stride, out);
+    }
+    else if(plan->span[s] >= FFT10_THREAD_CUTOFF && fft10_get_threads() > 1)
+    {
+        // the sub-transforms are independent
+        recursive_args a = { plan, s, in, in_stride, out };
+        fft10_parallel_for(radix, recursive_task, &a);
+        fft10_pass_parallel(plan, s, out);
+    }
+    else
+    {
+        size_t m = plan->span[s]/radix;
+        FFT10_PROF_BEGIN(t);
+        for(size_t r = 0; r < radix; r++)
+        {
+            fft10_recursive(plan, s-1, in + 2*r*in_stride, radix*in_stride, out + 2*r*m);
+        }
+        // leaves are timed per parent, a probe per leaf would cost more than the leaf
+        if(s-1 == 0 || s == plan->codelet)
+        {
+            PROF_LEAVES(t, plan, s-1, radix);
+        }
+        fft10_pass(plan, s, out);
+    }
+}
+
+void fft10_execute_strided(const fft10_plan* plan, const float* in, size_t in_stride, float* out) {
+    if(plan->blue)
+    {
+        fft10_bluestein_execute(plan->blue, in, in_stride, out, NULL);
+    }
+    else if(plan->nstages == 0)
+    {
+        out[0] = in[0];
+        out[1] = in[1];
+    }
+    else
+    {
+        FFT10_PROF_BEGIN(t);
+        fft10_recursive(plan, plan->nstages-1, in, in_stride, out);
+        // plans that are a single leaf or codelet
+        if(plan->nstages == 1 || plan->nstages == plan->codelet)
+        {
+            PROF_LEAVES(t, plan, plan->nstages-1, 1);
+        }
+    }
+}
+
+/*
+ * Splits n into the radices 10, 8, 4, 2, 5 and 3 (stage 0 first). If at most
+ * one radix occurs an odd number of times the stages are ordered as a
+ * palindrome, which makes the digit reversal its own inverse so the iterative
+ * engine can permute in place by swapping. variant (FFT10_SHAPE_*) gives the
+ * other decompositions tried by the measuring planner. Returns 0 if n has a
+ * prime factor above 5.
+ */
+int fft10_factor(size_t n, unsigned variant, fft10_shape* shape) {
+    static const int radices[6] = { 10, 8, 4, 2, 5, 3 };
+    int     count[6] = {0};
+    int     order[6];
+    int     odd = 0, middle = -1;
+    int     s = 0;
+
+    for(int i = 0; i < 6; i++)
+    {
+        if((radices[i] == 10 && (variant & FFT10_SHAPE_NO10)) || (radices[i] == 8 && (variant & FFT10_SHAPE_NO8)))
+        {
+            continue;
+        }
+        while(n % (size_t)radices[i] == 0)
+        {
+            n /= (size_t)radices[i];
+            count[i]++;
+        }
+    }
+    if(n != 1)
+    {
+        return 0;
+    }
+    for(int i = 0; i < 6; i++)
+    {
+        order[i] = variant & FFT10_SHAPE_REVERSE ? 5 - i : i;
+        if(count[order[i]] % 2)
+        {
+            odd++;
+            middle = order[i];
+        }
+    }
+
+    if(odd <= 1)
+    {
+        int half = 0;
+        for(int i = 0; i < 6; i++)
+        {
+            for(int c = 0; c < count[order[i]]/2; c++)
+            {
+                shape->radix[half++] = radices[order[i]];
+            }
+        }
+        s = half;
+        if(middle >= 0)
+        {
+            shape->radix[s++] = radices[middle];
+        }
+        for(int i = half-1; i >= 0; i--)
+        {
+            shape->radix[s++] = shape->radix[i];
+        }
+    }
+    else
+    {
+        for(int i = 0; i < 6; i++)
+        {
+            for(int c = 0; c < count[order[i]]; c++)
+            {
+                shape->radix[s++] = radices[order[i]];
+            }
+        }
+    }
+    shape->nstages  = s;
+    shape->codelets = 3;
+    shape->engine   = 0;
+    return 1;
+}
+
+void fft10_plan_free(fft10_plan* plan) {
+    if(plan->blue)
+    {
+        fft10_bluestein_destroy(plan->blue);
+    }
+    if(plan->real)
+    {
+        fft10_real_destroy(plan->real);
+    }
+    free(plan->tw_mem);
+    free(plan->twx_mem);
+    free(plan->rev);
+    free(plan);
+}
+
+/*
+ * Builds a plan of length n. shape gives its decomposition, NULL takes the
+ * one of fft10_factor (or Bluestein's algorithm for lengths it cannot split).
+ */
+fft10_plan* fft10_plan_build(size_t n, unsigned flags, const fft10_shape* shape) {
+    fft10_plan*  plan;
+    fft10_shape  factors;
+    size_t       total = 0;
+    size_t       L = 1;
+    int          s;
+
+    plan = (fft10_plan*)calloc(1, sizeof(*plan));
+    if(!plan)
+    {
+        return NULL;
+    }
+    plan->n     = n;
+    plan->flags = flags;
+    plan->sgn   = (flags & (FFT10_BACKWARD | FFT10_BACKWARD_RAW)) ? -1.0f : 1.0f;
+    plan->scale = (flags & FFT10_BACKWARD) ? (float)(1.0/(double)n) : 1.0f;
+    fft10_get_isa(); // detect the cpu before the first execution
+
+    if(flags & FFT10_REAL)
+    {
+        // double and fixed point plans support complex transforms only
+        plan->real = flags & FFT10_PRECISION_MASK ? NULL : fft10_real_create(n, flags & FFT10_MEASURE);
+        if(!plan->real)
+        {
+            free(plan);
+            return NULL;
+        }
+        return plan;
+    }
+
+    if(!shape)
+    {
+        if(!fft10_factor(n, 0, &factors))
+        {
+            // as well as 5-smooth lengths only
+            plan->blue = flags & FFT10_PRECISION_MASK ? NULL : fft10_bluestein_create(n, plan->sgn, plan->scale);
+            if(!plan->blue)
+            {
+                free(plan);
+                return NULL;
+            }
+            return plan;
+        }
+        shape = &factors;
+    }
+
+    plan->nstages     = shape->nstages;
+    plan->engine      = shape->engine;
+    plan->palindromic = 1;
+    for(s = 0; s < plan->nstages; s++)
+    {
+        plan->radix[s] = shape->radix[s];
+        plan->palindromic &= shape->radix[s] == shape->radix[plan->nstages-1-s];
+    }
+
+    for(s = 0; s < plan->nstages; s++)
+    {
+        L *= (size_t)plan->radix[s];
+        plan->span[s] = L;
+        if(s > 0)
+        {
+            total += (size_t)(plan->radix[s]-1)*(L/(size_t)plan->radix[s]);
+        }
+    }
+
+    if(flags & FFT10_PRECISION_MASK)
+    {
+        if(!fft10_precision_init(plan, total))
+        {
+            free(plan);
+            return NULL;
+        }
+        return plan;
+    }
+
+    // up to three leading radix 10 stages have an unrolled codelet
+    while(plan->codelet < shape->codelets && plan->codelet < plan->nstages && plan->radix[plan->codelet] == 10)
+    {
+        plan->codelet++;
+    }
+
+    if(total)
+    {
+        plan->tw_mem = (float*)malloc(2*total*sizeof(float));
+        if(!plan->tw_mem)
+        {
+            free(plan);
+            return NULL;
+        }
+    }
+
+    // twiddles are evaluated in double precision and rounded once
+    FFT10_PROF_BEGIN(twiddle);
+    float* t = plan->tw_mem;
+    for(s = 1; s < plan->nstages; s++)
+    {
+        size_t radix = (size_t)plan->radix[s];
+        size_t m     = plan->span[s]/radix;
+        double step  = -plan->sgn*2.0*FFT10_PI/(double)plan->span[s];
+        plan->tw[s] = t;
+        for(size_t r = 1; r < radix; r++)
+        {
+            for(size_t k = 0; k < m; k++)
+            {
+                double ang = step*(double)(r*k);
+                *t++ = (float)cos(ang);
+                *t++ = (float)sin(ang);
+            }
+        }
+    }
+    FFT10_PROF_END(twiddle, FFT10_PROFILE_TWIDDLE, 0, -1, 1, 2*total*sizeof(float));
+
+    if(plan->n*FFT10_BATCH_LANES*2*sizeof(float) <= FFT10_BATCH_MAX_BYTES)
+    {
+        plan->rev = (size_t*)malloc(plan->n*sizeof(size_t));
+        if(!plan->rev)
+        {
+            fft10_plan_free(plan);
+            return NULL;
+        }
+        fft10_digit_reversal(plan, plan->rev);
+    }
+    return plan;
+}
+
+/* a new plan, measured by fft10_tune_build for FFT10_MEASURE */
+static fft10_plan* plan_new(size_t n, unsigned flags) {
+    return flags & FFT10_MEASURE ? fft10_tune_build(n, flags) : fft10_plan_build(n, flags, NULL);
+}
+
+/*
+ * Function: fft10_plan_create
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Returns a plan for a transform of n complex values. The twiddles of
+ *     every stage are computed once when the plan is built. Unless FFT10_NO_CACHE
+ *     is given the plan is taken from (or added to) the process-wide plan cache,
+ *     so asking again for the same length returns the already built plan.
+ *
+ * Parameters:
+ *     size_t n:
+ *         The length of the transform. Lengths of the form 2^a*3^b*5^c run on
+ *         radix 2, 3, 4, 5, 8 and 10 stages, all others use Bluestein's
+ *         algorithm on top of a plan of such a length.
+ *     unsigned flags:
+ *         FFT10_ESTIMATE or a combination of the FFT10_* planner flags.
+ *         FFT10_ESTIMATE picks the decomposition by a fixed rule and costs
+ *         no measurements. FFT10_MEASURE times the candidate decompositions
+ *         of n and keeps the fastest, or takes the decision from the wisdom
+ *         of an earlier measurement (see fft10_wisdom_import).
+ *         FFT10_RECURSIVE / FFT10_ITERATIVE force the engine used by
+ *         out-of-place executions.
+ *         FFT10_BACKWARD gives the inverse transform, normalized by 1/n so
+ *         that a forward and a backward execution return the input.
+ *         FFT10_REAL gives a plan for real signals, executed with
+ *         fft10_execute_r2c and fft10_execute_c2r.
+ *         FFT10_DOUBLE, FFT10_Q15 or FFT10_Q31 give a plan for
+ *         fft10_execute_d, fft10_execute_q15 or fft10_execute_q31; these
+ *         need a length of the form 2^a*3^b*5^c and no FFT10_REAL.
+ *
+ * Returns:
+ *     The plan, or NULL if n is 0, the flags are not supported for n or memory
+ *     could not be allocated.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Every successful call has to be matched by a call to fft10_plan_destroy.
+ *
+ * ----------------------------------------------------------------------------
+ */
+fft10_plan* fft10_plan_create(size_t n, unsigned flags) {
+    fft10_plan* plan;
+    fft10_plan* built;
+    unsigned    key = flags & FFT10_PLAN_KEY_MASK;
+
+    if(n == 0)
+    {
+        return NULL;
+    }
+
+    if(flags & FFT10_NO_CACHE)
+    {
+        plan = plan_new(n, flags);
+        if(plan)
+        {
+            plan->refcount = 1;
+        }
+        return plan;
+    }
+
+    fft10_mutex_lock(&plan_cache_lock);
+    for(plan = plan_cache; plan; plan = plan->next)
+    {
+        if(plan->n == n && (plan->flags & FFT10_PLAN_KEY_MASK) == key)
+        {
+            plan->refcount++;
+            fft10_mutex_unlock(&plan_cache_lock);
+            return plan;
+        }
+    }
+    fft10_mutex_unlock(&plan_cache_lock);
+
+    // built without holding the lock, Bluestein plans create plans of their own
+    built = plan_new(n, key);
+    if(!built)
+    {
+        return NULL;
+    }
+
+    fft10_mutex_lock(&plan_cache_lock);
+    for(plan = plan_cache; plan; plan = plan->next)
+    {
+        if(plan->n == n && (plan->flags & FFT10_PLAN_KEY_MASK) == key)
+        {
+            break;
+        }
+    }
+    if(!plan)
+    {
+        plan       = built;
+        built      = NULL;
+        plan->next = plan_cache;
+        plan_cache = plan;
+    }
+    plan->refcount++;
+    fft10_mutex_unlock(&plan_cache_lock);
+
+    if(built)
+    {
+        // another thread was faster
+        fft10_plan_free(built);
+    }
+    return plan;
+}
+
+/*
+ * Floats of scratch that fft10_execute_work needs on plan, for in == out if
+ * in_place is set: the Bluestein buffers, the buffers of FFT10_REAL plans and
+ * the copy of the input that the iterative engine makes in place when the
+ * plan is not palindromic.
+ */
+size_t fft10_work_size(const fft10_plan* plan, int in_place) {
+    if(plan->real)
+    {
+        return fft10_real_work_size(plan->real);
+    }
+    if(plan->blue)
+    {
+        return fft10_bluestein_work_size(plan->blue);
+    }
+    return in_place && !plan->palindromic && plan->nstages > 0 ? 2*plan->n : 0;
+}
+
+/*
+ * fft10_execute with the scratch of the engines taken from work, which holds
+ * fft10_work_size floats; NULL allocates it per call where it is needed.
+ */
+int fft10_execute_work(const fft10_plan* plan, const float* in, float* out, float* work) {
+    unsigned engine = plan->flags | plan->engine;
+    int      iterative;
+
+    if(plan->flags & FFT10_PRECISION_MASK)
+    {
+        return -1;
+    }
+
+    if(engine & FFT10_ITERATIVE)
+    {
+        iterative = 1;
+    }
+    else if(engine & FFT10_RECURSIVE)
+    {
+        iterative = in == out;
+    }
+    else
+    {
+        iterative = in == out || plan->n*2*sizeof(float) > FFT10_RECURSIVE_MAX_BYTES;
+    }
+
+    FFT10_PROF_BEGIN(t);
+    if(plan->real)
+    {
+        fft10_real_r2c(plan->real, in, out, work);
+    }
+    else if(plan->blue)
+    {
+        fft10_bluestein_execute(plan->blue, in, 1, out, work);
+    }
+    else if(iterative)
+    {
+        fft10_execute_iterative(plan, in, out, work);
+    }
+    else
+    {
+        fft10_execute_strided(plan, in, 1, out);
+    }
+    FFT10_PROF_END(t, FFT10_PROFILE_EXECUTE, 0, -1, 1, plan->n*4*sizeof(float));
+    return 0;
+}
+
+/*
+ * Function: fft10_execute
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Computes the transform described by plan.
+ *
+ * Parameters:
+ *     const fft10_plan* plan:
+ *         Plan returned by fft10_plan_create.
+ *     const float* in:
+ *         Input signal, plan length complex values stored as interleaved re/im.
+ *     float* out:
+ *         Output spectrum, same layout as the input.
+ *
+ * Returns:
+ *     0, or -1 without touching out on double and fixed point plans, which run
+ *     on fft10_execute_d, fft10_execute_q15 and fft10_execute_q31.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * in == out runs the transform in place on the iterative engine. Otherwise in and
+ * out must not overlap; lengths above FFT10_RECURSIVE_MAX_BYTES of data also use
+ * the iterative engine unless FFT10_RECURSIVE is given or FFT10_MEASURE chose
+ * the recursive one.
+ * On FFT10_REAL plans this is fft10_execute_r2c.
+ *
+ * ----------------------------------------------------------------------------
+ */
+int fft10_execute(const fft10_plan* plan, const float* in, float* out) {
+    return fft10_execute_work(plan, in, out, NULL);
+}
+
+/*
+ * Function: fft10_plan_destroy
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Releases a plan returned by fft10_plan_create. Cached plans stay in the
+ *     cache so that the next request for the same length costs no setup; they
+ *     are freed by fft10_cleanup.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_plan_destroy(fft10_plan* plan) {
+    if(!plan)
+    {
+        return;
+    }
+    if(plan->flags & FFT10_NO_CACHE)
+    {
+        fft10_plan_free(plan);
+        return;
+    }
+    fft10_mutex_lock(&plan_cache_lock);
+    plan->refcount--;
+    fft10_mutex_unlock(&plan_cache_lock);
+}
+
+/*
+ * Function: fft10_cleanup
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Frees every cached plan that is no longer referenced.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_cleanup(void) {
+    fft10_plan** link;
+    fft10_plan*  unused;
+    int          freed;
+
+    // freeing a Bluestein plan releases its sub-plans, so repeat until nothing is left
+    do
+    {
+        freed  = 0;
+        unused = NULL;
+        fft10_mutex_lock(&plan_cache_lock);
+        link = &plan_cache;
+        while(*link)
+        {
+            fft10_plan* plan = *link;
+            if(plan->refcount <= 0)
+            {
+                *link      = plan->next;
+                plan->next = unused;
+                unused     = plan;
+            }
+            else
+            {
+                link = &plan->next;
+            }
+        }
+        fft10_mutex_unlock(&plan_cache_lock);
+
+        while(unused)
+        {
+            fft10_plan* next = unused->next;
+            fft10_plan_free(unused);
+            unused = next;
+            freed  = 1;
+        }
+    } while(freed);
+}
@@ -0,0 +1,486 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_precision.c
+ * Description: Double precision and fixed point (Q15, Q31) transforms. The
+ * butterflies of fft10_butterflies.inc and the engine of fft10_precision.inc
+ * are instantiated once per sample type, so all precisions run the same
+ * kernel source as the float path.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - add FFT10_DOUBLE, FFT10_Q15 and FFT10_Q31 plans
+ *
+ * ----------------------------------------------------------------------------
+ * Usage:
+ * ----------------------------------------------------------------------------
+ *     fft10_plan* p = fft10_plan_create(1000, FFT10_Q15);
+ *     int e = fft10_execute_q15(p, x, X);   // spectrum = X*2^e
+ *     fft10_plan_destroy(p);
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * The variants are scalar: one CV holds one complex value. Fixed point values
+ * are widened to 32 (Q15) or 64 bit (Q31) inside a butterfly, products are
+ * rounded back to the Q format after every multiplication and stores saturate.
+ * Block scaling before every stage (see fft10_precision.inc) keeps the stages
+ * from saturating, the sum of the shifts is returned as the block exponent.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "fft10_internal.h"
+
+/* ------------------------------------------------------------------------- */
+/* double                                                                    */
+/* ------------------------------------------------------------------------- */
+
+typedef struct { double re, im; } fft10_cd;
+
+static inline fft10_cd cd_ld(const double* p) {
+    fft10_cd v = { p[0], p[1] };
+    return v;
+}
+
+static inline void cd_st(double* p, fft10_cd v) {
+    p[0] = v.re;
+    p[1] = v.im;
+}
+
+static inline fft10_cd cd_set(double re, double im) {
+    fft10_cd v = { re, im };
+    return v;
+}
+
+static inline fft10_cd cd_add(fft10_cd a, fft10_cd b) {
+    fft10_cd v = { a.re + b.re, a.im + b.im };
+    return v;
+}
+
+static inline fft10_cd cd_sub(fft10_cd a, fft10_cd b) {
+    fft10_cd v = { a.re - b.re, a.im - b.im };
+    return v;
+}
+
+static inline fft10_cd cd_mul(fft10_cd a, fft10_cd b) {
+    fft10_cd v = { a.re*b.re - a.im*b.im, a.re*b.im + a.im*b.re };
+    return v;
+}
+
+static inline fft10_cd cd_scale(fft10_cd a, double c) {
+    fft10_cd v = { a.re*c, a.im*c };
+    return v;
+}
+
+static inline fft10_cd cd_mulnj(fft10_cd a) {
+    fft10_cd v = { a.im, -a.re };
+    return v;
+}
+
+#define KREAL           double
+#define CV              fft10_cd
+#define KSTEP           1
+#define KNAME(name)     name##_d
+#define KATTR
+#define KPASS_ONLY
+#define KTW(c)          (c)
+#define CV_LD(p)        cd_ld(p)
+#define CV_ST(p, v)     cd_st(p, v)
+#define CV_LDT(p)       cd_ld(p)
+#define CV_SET(re, im)  cd_set(re, im)
+#define CV_ADD(a, b)    cd_add(a, b)
+#define CV_SUB(a, b)    cd_sub(a, b)
+#define CV_MUL(a, b)    cd_mul(a, b)
+#define CV_SCALE(a, c)  cd_scale(a, c)
+#define CV_MADD(a, b, c) cd_add(a, cd_scale(b, c))
+#define CV_MULNJ(a)     cd_mulnj(a)
+#include "fft10_butterflies.inc"
+#include "fft10_precision.inc"
+
+#undef KREAL
+#undef CV
+#undef KNAME
+#undef KTW
+#undef CV_LD
+#undef CV_ST
+#undef CV_LDT
+#undef CV_SET
+#undef CV_ADD
+#undef CV_SUB
+#undef CV_MUL
+#undef CV_SCALE
+#undef CV_MADD
+#undef CV_MULNJ
+
+/* ------------------------------------------------------------------------- */
+/* Q15, 16 bit storage with 32 bit intermediates                             */
+/* ------------------------------------------------------------------------- */
+
+typedef struct { int32_t re, im; } fft10_cq15;
+
+// the constant c in [-1, 1] in Q15, +1 saturates to 32767; plain arithmetic so that
+// the butterfly constants fold at compile time
+static inline int32_t q15_const(double c) {
+    double v = c*32768.0 + (c < 0.0 ? -0.5 : 0.5);
+    return v >= 32767.0 ? 32767 : (int32_t)v;
+}
+
+static inline int16_t q15_sat(int32_t v) {
+    return (int16_t)(v > 32767 ? 32767 : v < -32768 ? -32768 : v);
+}
+
+// a*c/2^15 rounded to nearest
+static inline int32_t q15_mulc(int32_t a, int32_t c) {
+    return (int32_t)(((int64_t)a*c + (1 << 14)) >> 15);
+}
+
+static inline fft10_cq15 cq15_ld(const int16_t* p) {
+    fft10_cq15 v = { p[0], p[1] };
+    return v;
+}
+
+static inline void cq15_st(int16_t* p, fft10_cq15 v) {
+    p[0] = q15_sat(v.re);
+    p[1] = q15_sat(v.im);
+}
+
+static inline fft10_cq15 cq15_set(double re, double im) {
+    fft10_cq15 v = { q15_const(re), q15_const(im) };
+    return v;
+}
+
+static inline fft10_cq15 cq15_add(fft10_cq15 a, fft10_cq15 b) {
+    fft10_cq15 v = { a.re + b.re, a.im + b.im };
+    return v;
+}
+
+static inline fft10_cq15 cq15_sub(fft10_cq15 a, fft10_cq15 b) {
+    fft10_cq15 v = { a.re - b.re, a.im - b.im };
+    return v;
+}
+
+static inline fft10_cq15 cq15_mul(fft10_cq15 a, fft10_cq15 b) {
+    fft10_cq15 v = {
+        (int32_t)(((int64_t)a.re*b.re - (int64_t)a.im*b.im + (1 << 14)) >> 15),
+        (int32_t)(((int64_t)a.re*b.im + (int64_t)a.im*b.re + (1 << 14)) >> 15)
+    };
+    return v;
+}
+
+static inline fft10_cq15 cq15_scale(fft10_cq15 a, double c) {
+    int32_t    q = q15_const(c);
+    fft10_cq15 v = { q15_mulc(a.re, q), q15_mulc(a.im, q) };
+    return v;
+}
+
+static inline fft10_cq15 cq15_mulnj(fft10_cq15 a) {
+    fft10_cq15 v = { a.im, -a.re };
+    return v;
+}
+
+#define KREAL           int16_t
+#define CV              fft10_cq15
+#define KNAME(name)     name##_q15
+#define KFIXED
+#define KQMAX           32767
+#define KTW(c)          ((int16_t)q15_const(c))
+#define CV_LD(p)        cq15_ld(p)
+#define CV_ST(p, v)     cq15_st(p, v)
+#define CV_LDT(p)       cq15_ld(p)
+#define CV_SET(re, im)  cq15_set(re, im)
+#define CV_ADD(a, b)    cq15_add(a, b)
+#define CV_SUB(a, b)    cq15_sub(a, b)
+#define CV_MUL(a, b)    cq15_mul(a, b)
+#define CV_SCALE(a, c)  cq15_scale(a, c)
+#define CV_MADD(a, b, c) cq15_add(a, cq15_scale(b, c))
+#define CV_MULNJ(a)     cq15_mulnj(a)
+#include "fft10_butterflies.inc"
+#include "fft10_precision.inc"
+
+#undef KREAL
+#undef CV
+#undef KNAME
+#undef KQMAX
+#undef KTW
+#undef CV_LD
+#undef CV_ST
+#undef CV_LDT
+#undef CV_SET
+#undef CV_ADD
+#undef CV_SUB
+#undef CV_MUL
+#undef CV_SCALE
+#undef CV_MADD
+#undef CV_MULNJ
+
+/* ------------------------------------------------------------------------- */
+/* Q31, 32 bit storage with 64 bit intermediates                             */
+/* ------------------------------------------------------------------------- */
+
+typedef struct { int64_t re, im; } fft10_cq31;
+
+// the constant c in [-1, 1] in Q31, +1 saturates to 2^31-1
+static inline int32_t q31_const(double c) {
+    double v = c*2147483648.0 + (c < 0.0 ? -0.5 : 0.5);
+    return v >= 2147483647.0 ? 2147483647 : (int32_t)v;
+}
+
+static inline int32_t q31_sat(int64_t v) {
+    return (int32_t)(v > 2147483647LL ? 2147483647LL : v < -2147483648LL ? -2147483648LL : v);
+}
+
+// a*c/2^31 rounded to nearest for |a| < 2^34, split so that no product exceeds 64 bit
+static inline int64_t q31_mulc(int64_t a, int32_t c) {
+    int64_t hi = a >> 16;
+    int64_t lo = a & 0xffff;
+    return (hi*c + ((lo*c) >> 16) + (1 << 14)) >> 15;
+}
+
+static inline fft10_cq31 cq31_ld(const int32_t* p) {
+    fft10_cq31 v = { p[0], p[1] };
+    return v;
+}
+
+static inline void cq31_st(int32_t* p, fft10_cq31 v) {
+    p[0] = q31_sat(v.re);
+    p[1] = q31_sat(v.im);
+}
+
+static inline fft10_cq31 cq31_set(double re, double im) {
+    fft10_cq31 v = { q31_const(re), q31_const(im) };
+    return v;
+}
+
+static inline fft10_cq31 cq31_add(fft10_cq31 a, fft10_cq31 b) {
+    fft10_cq31 v = { a.re + b.re, a.im + b.im };
+    return v;
+}
+
+static inline fft10_cq31 cq31_sub(fft10_cq31 a, fft10_cq31 b) {
+    fft10_cq31 v = { a.re - b.re, a.im - b.im };
+    return v;
+}
+
+// the twiddle b holds Q31 constants
+static inline fft10_cq31 cq31_mul(fft10_cq31 a, fft10_cq31 b) {
+    fft10_cq31 v = {
+        q31_mulc(a.re, (int32_t)b.re) - q31_mulc(a.im, (int32_t)b.im),
+        q31_mulc(a.re, (int32_t)b.im) + q31_mulc(a.im, (int32_t)b.re)
+    };
+    return v;
+}
+
+static inline fft10_cq31 cq31_scale(fft10_cq31 a, double c) {
+    int32_t    q = q31_const(c);
+    fft10_cq31 v = { q31_mulc(a.re, q), q31_mulc(a.im, q) };
+    return v;
+}
+
+static inline fft10_cq31 cq31_mulnj(fft10_cq31 a) {
+    fft10_cq31 v = { a.im, -a.re };
+    return v;
+}
+
+#define KREAL           int32_t
+#define CV              fft10_cq31
+#define KNAME(name)     name##_q31
+#define KQMAX           2147483647LL
+#define KTW(c)          q31_const(c)
+#define CV_LD(p)        cq31_ld(p)
+#define CV_ST(p, v)     cq31_st(p, v)
+#define CV_LDT(p)       cq31_ld(p)
+#define CV_SET(re, im)  cq31_set(re, im)
+#define CV_ADD(a, b)    cq31_add(a, b)
+#define CV_SUB(a, b)    cq31_sub(a, b)
+#define CV_MUL(a, b)    cq31_mul(a, b)
+#define CV_SCALE(a, c)  cq31_scale(a, c)
+#define CV_MADD(a, b, c) cq31_add(a, cq31_scale(b, c))
+#define CV_MULNJ(a)     cq31_mulnj(a)
+#include "fft10_butterflies.inc"
+#include "fft10_precision.inc"
+
+/* ------------------------------------------------------------------------- */
+/* plans and entry points                                                    */
+/* ------------------------------------------------------------------------- */
+
+/*
+ * Twiddles of a FFT10_DOUBLE/Q15/Q31 plan with its stages already set up; total
+ * is the number of complex twiddles. Returns 0 if memory could not be allocated.
+ */
+int fft10_precision_init(fft10_plan* plan, size_t total) {
+    size_t size = plan->flags & FFT10_DOUBLE ? sizeof(double)
+                : plan->flags & FFT10_Q15    ? sizeof(int16_t)
+                :                              sizeof(int32_t);
+
+    plan->twx_mem = malloc(2*(total ? total : 1)*size);
+    if(!plan->twx_mem)
+    {
+        return 0;
+    }
+    if(plan->flags & FFT10_DOUBLE)
+    {
+        twiddles_d(plan, (double*)plan->twx_mem);
+    }
+    else if(plan->flags & FFT10_Q15)
+    {
+        twiddles_q15(plan, (int16_t*)plan->twx_mem);
+    }
+    else
+    {
+        twiddles_q31(plan, (int32_t*)plan->twx_mem);
+    }
+    return 1;
+}
+
+/* largest e with 2^e <= n */
+static int floor_log2(size_t n) {
+    int e = 0;
+
+    while(n >>= 1)
+    {
+        e++;
+    }
+    return e;
+}
+
+/*
+ * Function: fft10_execute_d
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     fft10_execute in double precision.
+ *
+ * Parameters:
+ *     const fft10_plan* plan:
+ *         Plan returned by fft10_plan_create with FFT10_DOUBLE.
+ *     const double* in:
+ *         n complex values as interleaved re/im.
+ *     double* out:
+ *         The transform, same layout; may be equal to in.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Does nothing on plans created without FFT10_DOUBLE.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_execute_d(const fft10_plan* plan, const double* in, double* out) {
+    if(!(plan->flags & FFT10_DOUBLE))
+    {
+        return;
+    }
+    execute_d(plan, in, out);
+    if(plan->flags & FFT10_BACKWARD)
+    {
+        double c = 1.0/(double)plan->n;
+        for(size_t i = 0; i < 2*plan->n; i++)
+        {
+            out[i] *= c;
+        }
+    }
+}
+
+/*
+ * Function: fft10_execute_q15
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Fixed point transform of Q15 values with block floating point scaling.
+ *
+ * Parameters:
+ *     const fft10_plan* plan:
+ *         Plan returned by fft10_plan_create with FFT10_Q15.
+ *     const int16_t* in:
+ *         n complex Q15 values as interleaved re/im.
+ *     int16_t* out:
+ *         The transform, same layout; may be equal to in.
+ *
+ * Returns:
+ *     The block exponent e: the transform of in is out*2^e. FFT10_BACKWARD
+ *     plans include the 1/n normalization in out and e.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Does nothing and returns 0 on plans created without FFT10_Q15.
+ *
+ * ----------------------------------------------------------------------------
+ */
+int fft10_execute_q15(const fft10_plan* plan, const int16_t* in, int16_t* out) {
+    int e;
+
+    if(!(plan->flags & FFT10_Q15))
+    {
+        return 0;
+    }
+    e = execute_q15(plan, in, out);
+    if(plan->flags & FFT10_BACKWARD)
+    {
+        // 1/n = (2^b/n)*2^-b with 2^b/n in (1/2, 1]
+        int     b = floor_log2(plan->n);
+        int32_t c = q15_const(ldexp(1.0, b)/(double)plan->n);
+        for(size_t i = 0; i < 2*plan->n; i++)
+        {
+            out[i] = (int16_t)q15_mulc(out[i], c);
+        }
+        e -= b;
+    }
+    return e;
+}
+
+/*
+ * Function: fft10_execute_q31
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     fft10_execute_q15 for Q31 values.
+ *
+ * Parameters:
+ *     const fft10_plan* plan:
+ *         Plan returned by fft10_plan_create with FFT10_Q31.
+ *     const int32_t* in:
+ *         n complex Q31 values as interleaved re/im.
+ *     int32_t* out:
+ *         The transform, same layout; may be equal to in.
+ *
+ * Returns:
+ *     The block exponent e: the transform of in is out*2^e.
+ *
+ * ----------------------------------------------------------------------------
+ */
+int fft10_execute_q31(const fft10_plan* plan, const int32_t* in, int32_t* out) {
+    int e;
+
+    if(!(plan->flags & FFT10_Q31))
+    {
+        return 0;
+    }
+    e = execute_q31(plan, in, out);
+    if(plan->flags & FFT10_BACKWARD)
+    {
+        int     b = floor_log2(plan->n);
+        int32_t c = q31_const(ldexp(1.0, b)/(double)plan->n);
+        for(size_t i = 0; i < 2*plan->n; i++)
+        {
+            out[i] = (int32_t)q31_mulc(out[i], c);
+        }
+        e -= b;
+    }
+    return e;
+}
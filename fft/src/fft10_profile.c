@@ -0,0 +1,417 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_profile.c
+ * Description: Opt-in instrumentation of the hot paths. With FFT10_PROFILE
+ * defined at compile time the engines record wall time, call counts, bytes
+ * touched and (on Linux, where perf_event_open is permitted) cycles,
+ * instructions and cache misses per kind of work and radix or stage. Without
+ * FFT10_PROFILE the probes compile to nothing and this API reports that
+ * profiling is unavailable.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - add per-stage/per-radix timers, hardware counters and JSON dump
+ * 18.10.2026 - feature test macros for clock_gettime and syscall under -std=c99
+ * 18.10.2026 - perf event groups are closed when their thread exits
+ *
+ * ----------------------------------------------------------------------------
+ * Usage:
+ * ----------------------------------------------------------------------------
+ *     gcc -DFFT10_PROFILE ... ../src/fft10*.c
+ *     fft10_profile_enable(FFT10_PROFILE_TIME | FFT10_PROFILE_HW);
+ *     fft10_execute(plan, x, X);
+ *     fft10_profile_dump("profile.json");
+ *
+ * ----------------------------------------------------------------------------
+ * Dependencies:
+ * ----------------------------------------------------------------------------
+ * Standard C Library, linux/perf_event.h for the hardware counters
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Counters are process-wide and updated atomically, so work done on the thread
+ * pool is included. Every thread opens its own perf event group the first
+ * time it records with FFT10_PROFILE_HW and closes it when it exits; threads
+ * where that fails record time only.
+ *
+ * Leaves are timed per block of leaves (one probe per parent transform or
+ * per block of the iterative engine), passes per call. A probe costs two
+ * clock reads, plus two read() calls with hardware counters, so the
+ * numbers of very short transforms include some probe overhead.
+ *
+ * FFT10_PROFILE_EXECUTE is inclusive: Bluestein and real plans count their
+ * inner fft10_execute calls as well.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#define _POSIX_C_SOURCE 199309L     // clock_gettime under -std=c99
+#define _DEFAULT_SOURCE             // syscall of the perf counters
+
+#include <stdio.h>
+#include <string.h>
+#include "fft10_internal.h"
+
+#ifdef FFT10_PROFILE
+
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <pthread.h>
+#define FFT10_HAVE_PERF
+#endif
+
+#if defined(__GNUC__)
+#define PROF_TLS            __thread
+#define PROF_ADD(field, v)  __atomic_fetch_add(&(field), (unsigned long long)(v), __ATOMIC_RELAXED)
+#define PROF_LOAD(v)        __atomic_load_n(&(v), __ATOMIC_RELAXED)
+#else
+#define PROF_TLS
+#define PROF_ADD(field, v)  ((field) += (unsigned long long)(v))
+#define PROF_LOAD(v)        (v)
+#endif
+
+static const char* prof_kind_names[FFT10_PROFILE_KINDS] = {
+    "execute", "permute", "leaf", "codelet", "pass", "stage", "batch", "twiddle"
+};
+
+static fft10_profile_counter  prof_table[FFT10_PROFILE_KINDS][FFT10_PROFILE_SLOTS];
+static unsigned               prof_on = 0;
+
+static unsigned long long now_ns(void) {
+#ifdef _WIN32
+    LARGE_INTEGER f, c;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&c);
+    return (unsigned long long)((double)c.QuadPart*1e9/(double)f.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec*1000000000ull + (unsigned long long)ts.tv_nsec;
+#endif
+}
+
+#ifdef FFT10_HAVE_PERF
+// perf event group of the calling thread: -2 not opened yet, -1 not permitted
+static PROF_TLS int prof_fds[3] = { -2, -2, -2 };
+
+// closes the group of a thread when it exits (pool workers after fft10_set_threads)
+static pthread_key_t  prof_key;
+static pthread_once_t prof_key_once = PTHREAD_ONCE_INIT;
+
+static void perf_close(void* arg) {
+    int* fds = (int*)arg;
+
+    for(int i = 0; i < 3; i++)
+    {
+        close(fds[i]);
+        fds[i] = -2;
+    }
+}
+
+static void perf_key_create(void) {
+    pthread_key_create(&prof_key, perf_close);
+}
+
+static int perf_open(void) {
+    static const unsigned long long configs[3] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES
+    };
+
+    if(prof_fds[0] != -2)
+    {
+        return prof_fds[0] >= 0;
+    }
+    for(int i = 0; i < 3; i++)
+    {
+        struct perf_event_attr attr;
+
+        memset(&attr, 0, sizeof(attr));
+        attr.type           = PERF_TYPE_HARDWARE;
+        attr.size           = sizeof(attr);
+        attr.config         = configs[i];
+        attr.read_format    = PERF_FORMAT_GROUP;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        prof_fds[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, i ? prof_fds[0] : -1, 0);
+        if(prof_fds[i] < 0)
+        {
+            while(i-- > 0)
+            {
+                close(prof_fds[i]);
+            }
+            prof_fds[0] = prof_fds[1] = prof_fds[2] = -1;
+            return 0;
+        }
+    }
+    pthread_once(&prof_key_once, perf_key_create);
+    pthread_setspecific(prof_key, prof_fds);
+    return 1;
+}
+
+/* cycles, instructions and cache misses of the calling thread so far */
+static int perf_read(unsigned long long* v) {
+    unsigned long long buf[4];
+
+    if(!perf_open() || read(prof_fds[0], buf, sizeof(buf)) != (ssize_t)sizeof(buf))
+    {
+        return 0;
+    }
+    v[0] = buf[1];
+    v[1] = buf[2];
+    v[2] = buf[3];
+    return 1;
+}
+#else
+static int perf_read(unsigned long long* v) {
+    (void)v;
+    return 0;
+}
+#endif
+
+void fft10_prof_begin(fft10_prof_mark* mark) {
+    mark->on = PROF_LOAD(prof_on);
+    if(!mark->on)
+    {
+        return;
+    }
+    if((mark->on & FFT10_PROFILE_HW) && !perf_read(mark->hw))
+    {
+        mark->on &= ~FFT10_PROFILE_HW;
+    }
+    mark->t = now_ns();
+}
+
+/* adds one probe to the slot [kind][index] */
+static void prof_add(int kind, int index, unsigned long long ns, const unsigned long long* hw,
+                     size_t calls, size_t bytes) {
+    fft10_profile_counter* c;
+
+    if(index < 0 || index >= FFT10_PROFILE_SLOTS)
+    {
+        return;
+    }
+    c = &prof_table[kind][index];
+    PROF_ADD(c->calls, calls);
+    PROF_ADD(c->ns, ns);
+    PROF_ADD(c->bytes, bytes);
+    if(hw)
+    {
+        PROF_ADD(c->cycles, hw[0]);
+        PROF_ADD(c->instructions, hw[1]);
+        PROF_ADD(c->cache_misses, hw[2]);
+    }
+}
+
+/*
+ * Records the work since mark under [kind][index], and under
+ * [FFT10_PROFILE_STAGE][stage] if stage >= 0.
+ */
+void fft10_prof_end(const fft10_prof_mark* mark, int kind, int index, int stage, size_t calls, size_t bytes) {
+    unsigned long long  ns;
+    unsigned long long  hw[3];
+    unsigned long long* dhw = NULL;
+
+    if(!mark->on)
+    {
+        return;
+    }
+    ns = now_ns() - mark->t;
+    if((mark->on & FFT10_PROFILE_HW) && perf_read(hw))
+    {
+        for(int i = 0; i < 3; i++)
+        {
+            hw[i] -= mark->hw[i];
+        }
+        dhw = hw;
+    }
+    prof_add(kind, index, ns, dhw, calls, bytes);
+    if(stage >= 0)
+    {
+        prof_add(FFT10_PROFILE_STAGE, stage, ns, dhw, calls, bytes);
+    }
+}
+
+#endif
+
+/*
+ * Function: fft10_profile_enable
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Starts or stops recording.
+ *
+ * Parameters:
+ *     unsigned what:
+ *         0 to stop, FFT10_PROFILE_TIME for timers and counts, plus
+ *         FFT10_PROFILE_HW for the hardware counters.
+ *
+ * Returns:
+ *     What is recorded from now on: 0 if the library was compiled without
+ *     FFT10_PROFILE, without FFT10_PROFILE_HW if perf_event_open is not
+ *     available or not permitted to the calling thread.
+ *
+ * ----------------------------------------------------------------------------
+ */
+unsigned fft10_profile_enable(unsigned what) {
+#ifdef FFT10_PROFILE
+    unsigned long long hw[3];
+
+    if(what & FFT10_PROFILE_HW)
+    {
+        what |= FFT10_PROFILE_TIME;
+        if(!perf_read(hw))
+        {
+            what &= ~FFT10_PROFILE_HW;
+        }
+    }
+    what &= FFT10_PROFILE_TIME | FFT10_PROFILE_HW;
+#if defined(__GNUC__)
+    __atomic_store_n(&prof_on, what, __ATOMIC_RELAXED);
+#else
+    prof_on = what;
+#endif
+    return what;
+#else
+    (void)what;
+    return 0;
+#endif
+}
+
+/*
+ * Function: fft10_profile_reset
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Sets every counter to zero. Call it while no transform is running.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_profile_reset(void) {
+#ifdef FFT10_PROFILE
+    memset(prof_table, 0, sizeof(prof_table));
+#endif
+}
+
+/*
+ * Function: fft10_profile_get
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Reads one counter.
+ *
+ * Parameters:
+ *     int kind:
+ *         One of the FFT10_PROFILE_* kinds.
+ *     int index:
+ *         The radix for leaves, passes and batch stages, the number of radix
+ *         10 stages for codelets, the stage number for FFT10_PROFILE_STAGE and
+ *         0 for the others.
+ *     fft10_profile_counter* counter:
+ *         Receives the counter.
+ *
+ * Returns:
+ *     0 on success, -1 if kind or index are out of range or the library was
+ *     compiled without FFT10_PROFILE.
+ *
+ * ----------------------------------------------------------------------------
+ */
+int fft10_profile_get(int kind, int index, fft10_profile_counter* counter) {
+#ifdef FFT10_PROFILE
+    if(kind < 0 || kind >= FFT10_PROFILE_KINDS || index < 0 || index >= FFT10_PROFILE_SLOTS)
+    {
+        return -1;
+    }
+    *counter = prof_table[kind][index];
+    return 0;
+#else
+    (void)kind;
+    (void)index;
+    (void)counter;
+    return -1;
+#endif
+}
+
+/*
+ * Function: fft10_profile_dump
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Writes every counter with at least one call as JSON:
+ *         {"enabled": {"time": true, "hw": false}, "counters": [
+ *             {"kind": "pass", "index": 10, "calls": 12, "ns": 3400, "bytes": ...,
+ *              "cycles": 0, "instructions": 0, "cache_misses": 0}, ...]}
+ *
+ * Parameters:
+ *     const char* path:
+ *         The file to write, NULL for stdout.
+ *
+ * Returns:
+ *     0 on success, -1 if the file could not be written or the library was
+ *     compiled without FFT10_PROFILE.
+ *
+ * ----------------------------------------------------------------------------
+ */
+int fft10_profile_dump(const char* path) {
+#ifdef FFT10_PROFILE
+    FILE*    f = path ? fopen(path, "w") : stdout;
+    unsigned on = PROF_LOAD(prof_on);
+    int      first = 1;
+    int      ok;
+
+    if(!f)
+    {
+        return -1;
+    }
+    fprintf(f, "{\n  \"enabled\": {\"time\": %s, \"hw\": %s},\n  \"counters\": [",
+            on & FFT10_PROFILE_TIME ? "true" : "false", on & FFT10_PROFILE_HW ? "true" : "false");
+    for(int k = 0; k < FFT10_PROFILE_KINDS; k++)
+    {
+        for(int i = 0; i < FFT10_PROFILE_SLOTS; i++)
+        {
+            fft10_profile_counter c = prof_table[k][i];
+            if(c.calls == 0)
+            {
+                continue;
+            }
+            fprintf(f, "%s\n    {\"kind\": \"%s\", \"index\": %d, \"calls\": %llu, \"ns\": %llu, \"bytes\": %llu, "
+                    "\"cycles\": %llu, \"instructions\": %llu, \"cache_misses\": %llu}",
+                    first ? "" : ",", prof_kind_names[k], i, c.calls, c.ns, c.bytes,
+                    c.cycles, c.instructions, c.cache_misses);
+            first = 0;
+        }
+    }
+    fprintf(f, "\n  ]\n}\n");
+    ok = !ferror(f);
+    if(path)
+    {
+        ok = fclose(f) == 0 && ok;
+    }
+    else
+    {
+        fflush(f);
+    }
+    return ok ? 0 : -1;
+#else
+    (void)path;
+    return -1;
+#endif
+}
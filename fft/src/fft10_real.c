@@ -0,0 +1,328 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_real.c
+ * Description: Transforms of real signals. For even n the n real values are
+ * read as n/2 complex values, transformed with a complex fft of half the length
+ * and separated into the n/2+1 non-redundant bins by one post-processing pass
+ * (and the other way round for the inverse). Odd lengths go through a complex
+ * transform of the full length.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - add real-to-complex and complex-to-real transforms
+ * 18.10.2026 - c2r is normalized like FFT10_BACKWARD
+ * 18.10.2026 - separate post-processing pass for the fused stft input
+ * 18.10.2026 - FFT10_MEASURE reaches the complex plans
+ * 18.10.2026 - scratch of the odd lengths and the complex plans may come from the caller
+ *
+ * ----------------------------------------------------------------------------
+ * Usage:
+ * ----------------------------------------------------------------------------
+ *     fft10_plan* p = fft10_plan_create(1000, FFT10_REAL);
+ *     fft10_execute_r2c(p, x, X);   // 1000 floats in, 501 complex bins out
+ *     fft10_execute_c2r(p, X, x);   // 501 complex bins in, x out
+ *     fft10_plan_destroy(p);
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * With h = n/2, z_j = x_2j + i*x_2j+1 and Z = FFT_h(z):
+ *     X_k = E_k + W_n^k*O_k,  E_k = (Z_k + conj(Z_h-k))/2,
+ *                             O_k = (Z_k - conj(Z_h-k))/(2i)
+ * Bins k and h-k are computed from the same two values, so the pass works in
+ * place and in == out is allowed if the buffer holds n+2 floats.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "fft10_internal.h"
+
+struct fft10_real {
+    size_t       n;
+    fft10_plan*  fwd;    // complex plan of length n/2 (n even) or n (n odd)
+    fft10_plan*  bwd;    // the same length, unnormalized backward
+    float*       rtw;    // W_n^k for k = 0..n/4, even n only
+};
+
+void fft10_real_destroy(fft10_real* real) {
+    if(!real)
+    {
+        return;
+    }
+    fft10_plan_destroy(real->fwd);
+    fft10_plan_destroy(real->bwd);
+    free(real->rtw);
+    free(real);
+}
+
+/* flags may hold FFT10_MEASURE, which is passed on to the complex plans */
+fft10_real* fft10_real_create(size_t n, unsigned flags) {
+    fft10_real* real;
+    size_t      len = n % 2 ? n : n/2;
+
+    real = (fft10_real*)calloc(1, sizeof(*real));
+    if(!real)
+    {
+        return NULL;
+    }
+    real->n   = n;
+    real->fwd = fft10_plan_create(len, flags);
+    real->bwd = fft10_plan_create(len, flags | FFT10_BACKWARD_RAW);
+    if(!real->fwd || !real->bwd)
+    {
+        fft10_real_destroy(real);
+        return NULL;
+    }
+
+    if(n % 2 == 0)
+    {
+        size_t h = n/2;
+        real->rtw = (float*)malloc(2*(h/2 + 1)*sizeof(float));
+        if(!real->rtw)
+        {
+            fft10_real_destroy(real);
+            return NULL;
+        }
+        for(size_t k = 0; k <= h/2; k++)
+        {
+            double ang = -2.0*FFT10_PI*(double)k/(double)n;
+            real->rtw[2*k]   = (float)cos(ang);
+            real->rtw[2*k+1] = (float)sin(ang);
+        }
+    }
+    return real;
+}
+
+/*
+ * Floats of scratch fft10_real_r2c and fft10_real_c2r need: the complex copy of
+ * odd lengths and what the complex plans need on top, in place for even n.
+ */
+size_t fft10_real_work_size(const fft10_real* real) {
+    int    in_place = real->n % 2 == 0;
+    size_t fwd = fft10_work_size(real->fwd, in_place);
+    size_t bwd = fft10_work_size(real->bwd, in_place);
+
+    return (real->n % 2 ? 4*real->n : 0) + (fwd > bwd ? fwd : bwd);
+}
+
+/* odd n: the real signal is widened to complex and the first n/2+1 bins are kept */
+static void r2c_odd(const fft10_real* real, const float* in, float* out, float* work) {
+    size_t n = real->n;
+    float* own = NULL;
+    float* buf = work;
+
+    if(!buf)
+    {
+        buf = own = (float*)malloc(4*n*sizeof(float));
+        if(!buf)
+        {
+            return;
+        }
+    }
+    for(size_t j = 0; j < n; j++)
+    {
+        buf[2*j]   = in[j];
+        buf[2*j+1] = 0.0f;
+    }
+    fft10_execute_work(real->fwd, buf, buf + 2*n, work ? work + 4*n : NULL);
+    memcpy(out, buf + 2*n, 2*(n/2 + 1)*sizeof(float));
+    free(own);
+}
+
+/* odd n: the Hermitian spectrum is completed and the real part of its inverse kept */
+static void c2r_odd(const fft10_real* real, const float* in, float* out, float* work) {
+    size_t n = real->n;
+    float* own = NULL;
+    float* buf = work;
+
+    if(!buf)
+    {
+        buf = own = (float*)malloc(4*n*sizeof(float));
+        if(!buf)
+        {
+            return;
+        }
+    }
+    for(size_t k = 0; k <= n/2; k++)
+    {
+        buf[2*k]   = in[2*k];
+        buf[2*k+1] = in[2*k+1];
+    }
+    for(size_t k = n/2 + 1; k < n; k++)
+    {
+        buf[2*k]   =  in[2*(n-k)];
+        buf[2*k+1] = -in[2*(n-k)+1];
+    }
+    buf[1] = 0.0f;
+    fft10_execute_work(real->bwd, buf, buf + 2*n, work ? work + 4*n : NULL);
+    for(size_t j = 0; j < n; j++)
+    {
+        out[j] = buf[2*(n+j)]/(float)n;
+    }
+    free(own);
+}
+
+/* work holds fft10_real_work_size floats, or is NULL to allocate the scratch per call */
+void fft10_real_r2c(const fft10_real* real, const float* in, float* out, float* work) {
+    if(real->n % 2)
+    {
+        r2c_odd(real, in, out, work);
+        return;
+    }
+
+    fft10_execute_work(real->fwd, in, out, work);
+    fft10_real_post(real, out);
+}
+
+/*
+ * Turns the half length transform Z in out[0..n-1] into the bins X_0..X_n/2 in
+ * out[0..n+1] (even n).
+ */
+void fft10_real_post(const fft10_real* real, float* out) {
+    size_t        h   = real->n/2;
+    const float*  w   = real->rtw;
+
+    // k = 0 and k = h come from Z_0 alone
+    float z0r = out[0], z0i = out[1];
+    out[0]     = z0r + z0i;
+    out[1]     = 0.0f;
+    out[2*h]   = z0r - z0i;
+    out[2*h+1] = 0.0f;
+
+    for(size_t k = 1; k <= h/2; k++)
+    {
+        size_t q  = h - k;
+        float  ar = out[2*k], ai = out[2*k+1];   // Z_k
+        float  br = out[2*q], bi = out[2*q+1];   // Z_h-k
+
+        float  er = 0.5f*(ar + br), ei = 0.5f*(ai - bi);   // E_k
+        float  or_ = 0.5f*(ai + bi), oi = 0.5f*(br - ar);  // O_k
+        float  tr = or_*w[2*k] - oi*w[2*k+1];              // W_n^k*O_k
+        float  ti = or_*w[2*k+1] + oi*w[2*k];
+
+        // X_h-k = conj(E_k) - conj(W_n^k*O_k), since W_n^(h-k) = -conj(W_n^k)
+        out[2*k]   = er + tr;
+        out[2*k+1] = ei + ti;
+        out[2*q]   = er - tr;
+        out[2*q+1] = ti - ei;
+    }
+}
+
+/* complex plan of half the length that fft10_real_post expects, NULL for odd n */
+const fft10_plan* fft10_real_half(const fft10_real* real) {
+    return real->n % 2 ? NULL : real->fwd;
+}
+
+void fft10_real_c2r(const fft10_real* real, const float* in, float* out, float* work) {
+    size_t        h   = real->n/2;
+    const float*  w   = real->rtw;
+
+    if(real->n % 2)
+    {
+        c2r_odd(real, in, out, work);
+        return;
+    }
+
+    // inverse of the post-processing; 1/n instead of 1/2 normalizes the result
+    // of the unnormalized half length inverse
+    float c  = 1.0f/(float)real->n;
+    float x0 = in[0], xh = in[2*h];
+    for(size_t k = 1; k <= h/2; k++)
+    {
+        size_t q  = h - k;
+        float  ar = in[2*k], ai = in[2*k+1];   // X_k
+        float  br = in[2*q], bi = in[2*q+1];   // X_h-k
+
+        float  er = c*(ar + br), ei = c*(ai - bi);   // 2c*E_k
+        float  dr = c*(ar - br), di = c*(ai + bi);   // 2c*W_n^k*O_k
+        float  or_ = dr*w[2*k] + di*w[2*k+1];        // 2c*O_k
+        float  oi = di*w[2*k] - dr*w[2*k+1];
+
+        // Z_k = E_k + i*O_k, Z_h-k = conj(E_k) + i*conj(O_k)
+        out[2*k]   = er - oi;
+        out[2*k+1] = ei + or_;
+        out[2*q]   = er + oi;
+        out[2*q+1] = or_ - ei;
+    }
+    out[0] = c*(x0 + xh);
+    out[1] = c*(x0 - xh);
+
+    fft10_execute_work(real->bwd, out, out, work);
+}
+
+/*
+ * Function: fft10_execute_r2c
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Forward transform of a real signal on a FFT10_REAL plan.
+ *
+ * Parameters:
+ *     const fft10_plan* plan:
+ *         Plan returned by fft10_plan_create with FFT10_REAL.
+ *     const float* in:
+ *         n real values.
+ *     float* out:
+ *         The n/2+1 bins X_0..X_n/2 as interleaved re/im, the others follow from
+ *         X_n-k = conj(X_k).
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * For even n, in may be equal to out if the buffer holds n+2 floats.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_execute_r2c(const fft10_plan* plan, const float* in, float* out) {
+    if(plan->real)
+    {
+        fft10_real_r2c(plan->real, in, out, NULL);
+    }
+}
+
+/*
+ * Function: fft10_execute_c2r
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Inverse of fft10_execute_r2c: the real signal whose spectrum has the bins
+ *     X_0..X_n/2 of in, normalized by 1/n like FFT10_BACKWARD so that
+ *     fft10_execute_c2r(fft10_execute_r2c(x)) = x. The imaginary parts of X_0
+ *     (and of X_n/2 for even n) are ignored.
+ *
+ * Parameters:
+ *     const fft10_plan* plan:
+ *         Plan returned by fft10_plan_create with FFT10_REAL.
+ *     const float* in:
+ *         n/2+1 complex bins as interleaved re/im.
+ *     float* out:
+ *         n real values.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * For even n, in may be equal to out.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_execute_c2r(const fft10_plan* plan, const float* in, float* out) {
+    if(plan->real)
+    {
+        fft10_real_c2r(plan->real, in, out, NULL);
+    }
+}
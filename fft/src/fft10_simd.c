@@ -0,0 +1,258 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_simd.c
+ * Description: SSE2, AVX2 and AVX-512 instantiations of the butterflies of
+ * fft10_butterflies.inc. One vector holds 2, 4 or 8 consecutive k of the
+ * interleaved re/im data, so the kernels work on the same layout as the scalar
+ * ones and no format conversion is needed.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - add SSE2/AVX2/AVX-512 radix10 kernels
+ * 18.10.2026 - instantiate the radix 2, 3, 4, 5 and 8 kernels as well
+ * 18.10.2026 - list the batch kernels
+ * 18.10.2026 - radix 10 column pass for the codelets
+ * 18.10.2026 - kernel source is generic in the element type (KREAL)
+ * 18.10.2026 - strided loads (CV_LDS) for the column pass of the codelets
+ * 18.10.2026 - gather of the batch layout
+ *
+ * ----------------------------------------------------------------------------
+ * Dependencies:
+ * ----------------------------------------------------------------------------
+ * gcc or clang on x86, every function carries its own target attribute so the
+ * file is compiled without any -m flags.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Complex products use the moveldup/movehdup + fmaddsub pattern on AVX2 and
+ * AVX-512, and shuffles with a sign mask on SSE2.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include "fft10_internal.h"
+
+#ifdef FFT10_HAVE_X86_SIMD
+
+#include <stddef.h>
+#include <string.h>
+#include <immintrin.h>
+
+#define SSE2_ATTR    __attribute__((target("sse2")))
+#define AVX2_ATTR    __attribute__((target("avx2,fma")))
+#define AVX512_ATTR  __attribute__((target("avx512f")))
+
+// bit pattern of the complex value re + i*im, used to broadcast it to every lane
+static inline long long pack_complex(float re, float im) {
+    float     v[2] = { re, im };
+    long long bits;
+    memcpy(&bits, v, sizeof(bits));
+    return bits;
+}
+
+/* ------------------------------------------------------------------------- */
+/* SSE2, two complex values per vector                                       */
+/* ------------------------------------------------------------------------- */
+
+static SSE2_ATTR inline __m128 sse2_set(float re, float im) {
+    return _mm_setr_ps(re, im, re, im);
+}
+
+static SSE2_ATTR inline __m128 sse2_mul(__m128 a, __m128 b) {
+    const __m128 neg_even = _mm_castsi128_ps(_mm_setr_epi32((int)0x80000000, 0, (int)0x80000000, 0));
+    __m128 br = _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 0, 0));
+    __m128 bi = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 1, 1));
+    __m128 as = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_add_ps(_mm_mul_ps(a, br), _mm_xor_ps(_mm_mul_ps(as, bi), neg_even));
+}
+
+// two complex values s apart
+static SSE2_ATTR inline __m128 sse2_lds(const float* p, size_t s) {
+    __m128 v = _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)p);
+    return _mm_loadh_pi(v, (const __m64*)(p + 2*s));
+}
+
+static SSE2_ATTR inline __m128 sse2_mulnj(__m128 a) {
+    const __m128 neg_odd = _mm_castsi128_ps(_mm_setr_epi32(0, (int)0x80000000, 0, (int)0x80000000));
+    return _mm_xor_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), neg_odd);
+}
+
+#define KREAL           float
+#define CV              __m128
+#define KSTEP           2
+#define KNAME(name)     name##_sse2
+#define KATTR           SSE2_ATTR
+#define CV_LD(p)        _mm_loadu_ps(p)
+#define CV_ST(p, v)     _mm_storeu_ps(p, v)
+#define CV_LDT(p)       _mm_loadu_ps(p)
+#define CV_LDS(p, s)    sse2_lds(p, s)
+#define CV_SET(re, im)  sse2_set(re, im)
+#define CV_ADD(a, b)    _mm_add_ps(a, b)
+#define CV_SUB(a, b)    _mm_sub_ps(a, b)
+#define CV_MUL(a, b)    sse2_mul(a, b)
+#define CV_SCALE(a, c)  _mm_mul_ps(a, _mm_set1_ps(c))
+#define CV_MADD(a, b, c) _mm_add_ps(a, _mm_mul_ps(b, _mm_set1_ps(c)))
+#define CV_MULNJ(a)     sse2_mulnj(a)
+#include "fft10_butterflies.inc"
+#undef KREAL
+#undef CV
+#undef KSTEP
+#undef KNAME
+#undef KATTR
+#undef CV_LD
+#undef CV_ST
+#undef CV_LDT
+#undef CV_LDS
+#undef CV_SET
+#undef CV_ADD
+#undef CV_SUB
+#undef CV_MUL
+#undef CV_SCALE
+#undef CV_MADD
+#undef CV_MULNJ
+
+const fft10_kernel_set fft10_kernels_sse2 = {
+    FFT10_ISA_SSE2,
+    2,
+    { NULL, NULL, pass2_sse2, pass3_sse2, pass4_sse2, pass5_sse2, NULL, NULL, pass8_sse2, NULL, pass10_sse2 },
+    { NULL, NULL, batch2_sse2, batch3_sse2, batch4_sse2, batch5_sse2, NULL, NULL, batch8_sse2, NULL, batch10_sse2 },
+    cols10_sse2,
+    gather_sse2
+};
+
+/* ------------------------------------------------------------------------- */
+/* AVX2 + FMA, four complex values per vector                                */
+/* ------------------------------------------------------------------------- */
+
+static AVX2_ATTR inline __m256 avx2_set(float re, float im) {
+    return _mm256_castsi256_ps(_mm256_set1_epi64x(pack_complex(re, im)));
+}
+
+static AVX2_ATTR inline __m256 avx2_mul(__m256 a, __m256 b) {
+    __m256 as = _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm256_fmaddsub_ps(a, _mm256_moveldup_ps(b), _mm256_mul_ps(as, _mm256_movehdup_ps(b)));
+}
+
+// four complex values s apart, gathered as 64 bit elements
+static AVX2_ATTR inline __m256 avx2_lds(const float* p, size_t s) {
+    __m256i idx = _mm256_set_epi64x(3*(long long)s, 2*(long long)s, (long long)s, 0);
+    return _mm256_castpd_ps(_mm256_i64gather_pd((const double*)p, idx, 8));
+}
+
+static AVX2_ATTR inline __m256 avx2_mulnj(__m256 a) {
+    const __m256 neg_odd = _mm256_castsi256_ps(_mm256_set1_epi64x((long long)0x8000000000000000ULL));
+    return _mm256_xor_ps(_mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1)), neg_odd);
+}
+
+#define KREAL           float
+#define CV              __m256
+#define KSTEP           4
+#define KNAME(name)     name##_avx2
+#define KATTR           AVX2_ATTR
+#define CV_LD(p)        _mm256_loadu_ps(p)
+#define CV_ST(p, v)     _mm256_storeu_ps(p, v)
+#define CV_LDT(p)       _mm256_loadu_ps(p)
+#define CV_LDS(p, s)    avx2_lds(p, s)
+#define CV_SET(re, im)  avx2_set(re, im)
+#define CV_ADD(a, b)    _mm256_add_ps(a, b)
+#define CV_SUB(a, b)    _mm256_sub_ps(a, b)
+#define CV_MUL(a, b)    avx2_mul(a, b)
+#define CV_SCALE(a, c)  _mm256_mul_ps(a, _mm256_set1_ps(c))
+#define CV_MADD(a, b, c) _mm256_fmadd_ps(b, _mm256_set1_ps(c), a)
+#define CV_MULNJ(a)     avx2_mulnj(a)
+#include "fft10_butterflies.inc"
+#undef KREAL
+#undef CV
+#undef KSTEP
+#undef KNAME
+#undef KATTR
+#undef CV_LD
+#undef CV_ST
+#undef CV_LDT
+#undef CV_LDS
+#undef CV_SET
+#undef CV_ADD
+#undef CV_SUB
+#undef CV_MUL
+#undef CV_SCALE
+#undef CV_MADD
+#undef CV_MULNJ
+
+const fft10_kernel_set fft10_kernels_avx2 = {
+    FFT10_ISA_AVX2,
+    4,
+    { NULL, NULL, pass2_avx2, pass3_avx2, pass4_avx2, pass5_avx2, NULL, NULL, pass8_avx2, NULL, pass10_avx2 },
+    { NULL, NULL, batch2_avx2, batch3_avx2, batch4_avx2, batch5_avx2, NULL, NULL, batch8_avx2, NULL, batch10_avx2 },
+    cols10_avx2,
+    gather_avx2
+};
+
+/* ------------------------------------------------------------------------- */
+/* AVX-512F, eight complex values per vector                                 */
+/* ------------------------------------------------------------------------- */
+
+static AVX512_ATTR inline __m512 avx512_set(float re, float im) {
+    return _mm512_castsi512_ps(_mm512_set1_epi64(pack_complex(re, im)));
+}
+
+static AVX512_ATTR inline __m512 avx512_mul(__m512 a, __m512 b) {
+    __m512 as = _mm512_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm512_fmaddsub_ps(a, _mm512_moveldup_ps(b), _mm512_mul_ps(as, _mm512_movehdup_ps(b)));
+}
+
+// eight complex values s apart, gathered as 64 bit elements
+static AVX512_ATTR inline __m512 avx512_lds(const float* p, size_t s) {
+    long long l   = (long long)s;
+    __m512i   idx = _mm512_set_epi64(7*l, 6*l, 5*l, 4*l, 3*l, 2*l, l, 0);
+    return _mm512_castpd_ps(_mm512_i64gather_pd(idx, (const double*)p, 8));
+}
+
+static AVX512_ATTR inline __m512 avx512_mulnj(__m512 a) {
+    const __m512i neg_odd = _mm512_set1_epi64((long long)0x8000000000000000ULL);
+    __m512 as = _mm512_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(as), neg_odd));
+}
+
+#define KREAL           float
+#define CV              __m512
+#define KSTEP           8
+#define KNAME(name)     name##_avx512
+#define KATTR           AVX512_ATTR
+#define CV_LD(p)        _mm512_loadu_ps(p)
+#define CV_ST(p, v)     _mm512_storeu_ps(p, v)
+#define CV_LDT(p)       _mm512_loadu_ps(p)
+#define CV_LDS(p, s)    avx512_lds(p, s)
+#define CV_SET(re, im)  avx512_set(re, im)
+#define CV_ADD(a, b)    _mm512_add_ps(a, b)
+#define CV_SUB(a, b)    _mm512_sub_ps(a, b)
+#define CV_MUL(a, b)    avx512_mul(a, b)
+#define CV_SCALE(a, c)  _mm512_mul_ps(a, _mm512_set1_ps(c))
+#define CV_MADD(a, b, c) _mm512_fmadd_ps(b, _mm512_set1_ps(c), a)
+#define CV_MULNJ(a)     avx512_mulnj(a)
+#include "fft10_butterflies.inc"
+
+const fft10_kernel_set fft10_kernels_avx512 = {
+    FFT10_ISA_AVX512,
+    8,
+    { NULL, NULL, pass2_avx512, pass3_avx512, pass4_avx512, pass5_avx512, NULL, NULL, pass8_avx512, NULL, pass10_avx512 },
+    { NULL, NULL, batch2_avx512, batch3_avx512, batch4_avx512, batch5_avx512, NULL, NULL, batch8_avx512, NULL, batch10_avx512 },
+    cols10_avx512,
+    gather_avx512
+};
+
+#endif
@@ -0,0 +1,499 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_stft.c
+ * Description: Streaming short-time Fourier transform of a real signal and its
+ * inverse. Samples are pushed in blocks of any size; the STFT keeps the last
+ * window of input in a ring buffer and writes one frame per hop straight into
+ * the buffer of the caller. The ISTFT overlap-adds the inverse transforms of
+ * pushed frames and returns hop samples per frame.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - add stft/istft with ring buffer and fused windowing
+ * 18.10.2026 - istft threshold relative to the largest window^2 overlap-add
+ * 18.10.2026 - scratch of the transforms allocated once at creation
+ *
+ * ----------------------------------------------------------------------------
+ * Usage:
+ * ----------------------------------------------------------------------------
+ *     fft10_stft* s = fft10_stft_create(1024, 1000, 250, NULL, FFT10_STFT_POWER);
+ *     // frames must hold count/250 + 1 frames of 1024/2+1 values
+ *     size_t nframes = fft10_stft_push(s, x, count, frames);
+ *     fft10_stft_destroy(s);
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * The ring holds every sample twice (at i and i + win_len), so the last window
+ * is always contiguous and no frame is ever copied out of the ring.
+ *
+ * For even 5-smooth nfft the frame is loaded with the window applied and the
+ * samples already in the digit reversed order of the half length complex
+ * transform, directly into the output frame; the butterfly stages and the real
+ * post-processing then run in place there. Other lengths go through a windowed
+ * copy and fft10_execute_r2c.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "fft10_internal.h"
+
+struct fft10_stft {
+    size_t             nfft;
+    size_t             win_len;
+    size_t             hop;
+    int                output;
+    fft10_plan*        plan;       // FFT10_REAL plan of length nfft
+    const fft10_plan*  half;       // its half length complex plan, NULL if not fused
+    size_t*            rev;        // digit reversal of half
+    float*             window;     // win_len values
+    float*             ring;       // 2*win_len values
+    size_t             pos;        // next write position in the ring
+    size_t             countdown;  // samples until the next frame
+    float*             work;       // nfft + 2 values
+    float*             scratch;    // scratch of the transform, NULL if it needs none
+};
+
+struct fft10_istft {
+    size_t             nfft;
+    size_t             win_len;
+    size_t             hop;
+    fft10_plan*        plan;
+    float*             window;
+    float*             acc;        // overlap-add of the signal, win_len values
+    float*             norm;       // overlap-add of window^2, win_len values
+    float              norm_min;   // samples with a smaller norm are written as zero
+    float*             work;       // nfft + 2 values
+    float*             scratch;    // scratch of the transform, NULL if it needs none
+};
+
+/*
+ * Function: fft10_window
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Fills w with a periodic window of len values (FFT10_WINDOW_RECT, _HANN,
+ *     _HAMMING or _BLACKMAN). Periodic windows overlap-add to a constant at hops
+ *     of len/2 (Hann, Hamming) or len/3 (Blackman).
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_window(int type, float* w, size_t len) {
+    for(size_t i = 0; i < len; i++)
+    {
+        double a = 2.0*FFT10_PI*(double)i/(double)len;
+        switch(type)
+        {
+        case FFT10_WINDOW_HANN:     w[i] = (float)(0.5 - 0.5*cos(a));                      break;
+        case FFT10_WINDOW_HAMMING:  w[i] = (float)(0.54 - 0.46*cos(a));                    break;
+        case FFT10_WINDOW_BLACKMAN: w[i] = (float)(0.42 - 0.5*cos(a) + 0.08*cos(2.0*a));   break;
+        default:                    w[i] = 1.0f;                                           break;
+        }
+    }
+}
+
+static float* window_copy(const float* window, size_t win_len) {
+    float* w = (float*)malloc(win_len*sizeof(float));
+
+    if(w)
+    {
+        if(window)
+        {
+            memcpy(w, window, win_len*sizeof(float));
+        }
+        else
+        {
+            fft10_window(FFT10_WINDOW_HANN, w, win_len);
+        }
+    }
+    return w;
+}
+
+/*
+ * Function: fft10_stft_create
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Creates a streaming STFT.
+ *
+ * Parameters:
+ *     size_t nfft:
+ *         Transform size, every frame has nfft/2+1 bins.
+ *     size_t win_len:
+ *         Samples per frame, at most nfft; the rest of the transform is zero
+ *         padding.
+ *     size_t hop:
+ *         Samples between the starts of two frames.
+ *     const float* window:
+ *         win_len window values (copied), NULL for a periodic Hann window.
+ *     int output:
+ *         FFT10_STFT_COMPLEX (nfft/2+1 interleaved complex values per frame),
+ *         FFT10_STFT_MAGNITUDE or FFT10_STFT_POWER (nfft/2+1 floats per frame).
+ *
+ * Returns:
+ *     The STFT, or NULL for invalid sizes or if memory could not be allocated.
+ *
+ * ----------------------------------------------------------------------------
+ */
+fft10_stft* fft10_stft_create(size_t nfft, size_t win_len, size_t hop, const float* window, int output) {
+    fft10_stft* st;
+    size_t      nscratch = 0;
+
+    if(nfft == 0 || win_len == 0 || win_len > nfft || hop == 0)
+    {
+        return NULL;
+    }
+
+    st = (fft10_stft*)calloc(1, sizeof(*st));
+    if(!st)
+    {
+        return NULL;
+    }
+    st->nfft    = nfft;
+    st->win_len = win_len;
+    st->hop     = hop;
+    st->output  = output;
+    st->plan    = fft10_plan_create(nfft, FFT10_REAL);
+    st->window  = window_copy(window, win_len);
+    st->ring    = (float*)malloc(2*win_len*sizeof(float));
+    st->work    = (float*)malloc((nfft + 2)*sizeof(float));
+    if(st->plan)
+    {
+        nscratch    = fft10_real_work_size(st->plan->real);
+        st->scratch = nscratch ? (float*)malloc(nscratch*sizeof(float)) : NULL;
+    }
+    if(!st->plan || !st->window || !st->ring || !st->work || (nscratch && !st->scratch))
+    {
+        fft10_stft_destroy(st);
+        return NULL;
+    }
+
+    // fused input path for lengths that run on the stages of the half length plan
+    st->half = fft10_real_half(st->plan->real);
+    if(st->half && st->half->nstages > 0)
+    {
+        st->rev = (size_t*)malloc(st->half->n*sizeof(size_t));
+        if(!st->rev)
+        {
+            fft10_stft_destroy(st);
+            return NULL;
+        }
+        fft10_digit_reversal(st->half, st->rev);
+    }
+    else
+    {
+        st->half = NULL;
+    }
+
+    fft10_stft_reset(st);
+    return st;
+}
+
+/*
+ * Function: fft10_stft_reset
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Drops the buffered input, the next frame is emitted after win_len new
+ *     samples.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_stft_reset(fft10_stft* st) {
+    memset(st->ring, 0, 2*st->win_len*sizeof(float));
+    st->pos       = 0;
+    st->countdown = st->win_len;
+}
+
+/* spectrum of the win_len samples at x into the nfft/2+1 bins at out */
+static void stft_frame(const fft10_stft* st, const float* x, float* out) {
+    const float* w = st->window;
+    size_t       L = st->win_len;
+
+    if(st->half)
+    {
+        // window, zero padding and digit reversal in one pass over the frame
+        for(size_t i = 0; i < st->half->n; i++)
+        {
+            size_t j = 2*st->rev[i];
+            out[2*i]   = j   < L ? x[j]*w[j]     : 0.0f;
+            out[2*i+1] = j+1 < L ? x[j+1]*w[j+1] : 0.0f;
+        }
+        fft10_execute_stages(st->half, out);
+        fft10_real_post(st->plan->real, out);
+    }
+    else
+    {
+        float* y = st->work == out ? out : st->work;
+        for(size_t j = 0; j < L; j++)
+        {
+            y[j] = x[j]*w[j];
+        }
+        memset(y + L, 0, (st->nfft - L)*sizeof(float));
+        fft10_real_r2c(st->plan->real, y, out, st->scratch);
+    }
+}
+
+/*
+ * Function: fft10_stft_push
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Appends count samples to the stream and writes every frame they complete
+ *     to frames, one after the other.
+ *
+ * Parameters:
+ *     fft10_stft* st:
+ *         STFT returned by fft10_stft_create.
+ *     const float* in:
+ *         count samples.
+ *     size_t count:
+ *         Number of samples.
+ *     float* frames:
+ *         Room for count/hop + 1 frames.
+ *
+ * Returns:
+ *     The number of frames written.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * The first frame is complete after win_len samples, every further one after
+ * hop more. No memory is allocated; lengths that need scratch for their
+ * transform (odd and Bluestein lengths) got it from fft10_stft_create.
+ *
+ * ----------------------------------------------------------------------------
+ */
+size_t fft10_stft_push(fft10_stft* st, const float* in, size_t count, float* frames) {
+    size_t L       = st->win_len;
+    size_t nbins   = st->nfft/2 + 1;
+    size_t fsize   = st->output == FFT10_STFT_COMPLEX ? 2*nbins : nbins;
+    size_t nframes = 0;
+
+    while(count > 0)
+    {
+        size_t run = count < st->countdown ? count : st->countdown;
+
+        // copy the run into both halves of the ring, split where it wraps
+        while(run > 0)
+        {
+            size_t part = L - st->pos < run ? L - st->pos : run;
+            memcpy(st->ring + st->pos,     in, part*sizeof(float));
+            memcpy(st->ring + st->pos + L, in, part*sizeof(float));
+            st->pos        = (st->pos + part) % L;
+            st->countdown -= part;
+            in            += part;
+            count         -= part;
+            run           -= part;
+        }
+
+        if(st->countdown == 0)
+        {
+            float* out = frames + nframes*fsize;
+            if(st->output == FFT10_STFT_COMPLEX)
+            {
+                stft_frame(st, st->ring + st->pos, out);
+            }
+            else
+            {
+                stft_frame(st, st->ring + st->pos, st->work);
+                for(size_t k = 0; k < nbins; k++)
+                {
+                    float re = st->work[2*k], im = st->work[2*k+1];
+                    float p  = re*re + im*im;
+                    out[k] = st->output == FFT10_STFT_POWER ? p : sqrtf(p);
+                }
+            }
+            nframes++;
+            st->countdown = st->hop;
+        }
+    }
+    return nframes;
+}
+
+/*
+ * Function: fft10_stft_destroy
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Frees an STFT returned by fft10_stft_create.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_stft_destroy(fft10_stft* st) {
+    if(!st)
+    {
+        return;
+    }
+    fft10_plan_destroy(st->plan);
+    free(st->rev);
+    free(st->window);
+    free(st->ring);
+    free(st->work);
+    free(st->scratch);
+    free(st);
+}
+
+/*
+ * Function: fft10_istft_create
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Creates a streaming inverse STFT (weighted overlap-add) for frames of an
+ *     STFT with the same nfft, win_len, hop and window.
+ *
+ * Returns:
+ *     The ISTFT, or NULL for invalid sizes or if memory could not be allocated.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Every frame is transformed back, multiplied by the window again and added up;
+ * the sum is divided by the overlap-add of window^2 at every sample, so any
+ * window and hop give back the input wherever that sum is above 1e-6 of its
+ * largest value. The other samples, e.g. at zeros of the window before the
+ * frames fully overlap, are written as zero.
+ *
+ * ----------------------------------------------------------------------------
+ */
+fft10_istft* fft10_istft_create(size_t nfft, size_t win_len, size_t hop, const float* window) {
+    fft10_istft* is;
+    size_t       nscratch = 0;
+
+    if(nfft == 0 || win_len == 0 || win_len > nfft || hop == 0 || hop > win_len)
+    {
+        return NULL;
+    }
+
+    is = (fft10_istft*)calloc(1, sizeof(*is));
+    if(!is)
+    {
+        return NULL;
+    }
+    is->nfft    = nfft;
+    is->win_len = win_len;
+    is->hop     = hop;
+    is->plan    = fft10_plan_create(nfft, FFT10_REAL);
+    is->window  = window_copy(window, win_len);
+    is->acc     = (float*)malloc(win_len*sizeof(float));
+    is->norm    = (float*)malloc(win_len*sizeof(float));
+    is->work    = (float*)malloc((nfft + 2)*sizeof(float));
+    if(is->plan)
+    {
+        nscratch    = fft10_real_work_size(is->plan->real);
+        is->scratch = nscratch ? (float*)malloc(nscratch*sizeof(float)) : NULL;
+    }
+    if(!is->plan || !is->window || !is->acc || !is->norm || !is->work || (nscratch && !is->scratch))
+    {
+        fft10_istft_destroy(is);
+        return NULL;
+    }
+
+    // largest overlap-add of window^2 once the frames fully overlap
+    for(size_t j = 0; j < hop; j++)
+    {
+        float sum = 0.0f;
+        for(size_t k = j; k < win_len; k += hop)
+        {
+            sum += is->window[k]*is->window[k];
+        }
+        is->norm_min = sum > is->norm_min ? sum : is->norm_min;
+    }
+    is->norm_min *= 1e-6f;
+    fft10_istft_reset(is);
+    return is;
+}
+
+/*
+ * Function: fft10_istft_reset
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Drops the partial sums of previous frames.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_istft_reset(fft10_istft* is) {
+    memset(is->acc, 0, is->win_len*sizeof(float));
+    memset(is->norm, 0, is->win_len*sizeof(float));
+}
+
+/*
+ * Function: fft10_istft_push
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Adds nframes complex frames (nfft/2+1 interleaved bins each) and writes the
+ *     hop samples every frame completes to out.
+ *
+ * Returns:
+ *     The number of samples written, nframes*hop.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * The samples of frame t are the ones the STFT frame t started with, so the
+ * output lines up with the input of the STFT without delay. No memory is
+ * allocated, the scratch of the transform comes from fft10_istft_create.
+ *
+ * ----------------------------------------------------------------------------
+ */
+size_t fft10_istft_push(fft10_istft* is, const float* frames, size_t nframes, float* out) {
+    size_t       L     = is->win_len;
+    size_t       hop   = is->hop;
+    size_t       nbins = is->nfft/2 + 1;
+    const float* w     = is->window;
+
+    for(size_t f = 0; f < nframes; f++)
+    {
+        fft10_real_c2r(is->plan->real, frames + 2*nbins*f, is->work, is->scratch);
+        for(size_t j = 0; j < L; j++)
+        {
+            is->acc[j]  += is->work[j]*w[j];
+            is->norm[j] += w[j]*w[j];
+        }
+
+        // the first hop samples get no more contributions
+        for(size_t j = 0; j < hop; j++)
+        {
+            out[j] = is->norm[j] > is->norm_min ? is->acc[j]/is->norm[j] : 0.0f;
+        }
+        memmove(is->acc, is->acc + hop, (L - hop)*sizeof(float));
+        memmove(is->norm, is->norm + hop, (L - hop)*sizeof(float));
+        memset(is->acc + L - hop, 0, hop*sizeof(float));
+        memset(is->norm + L - hop, 0, hop*sizeof(float));
+        out += hop;
+    }
+    return nframes*hop;
+}
+
+/*
+ * Function: fft10_istft_destroy
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Frees an ISTFT returned by fft10_istft_create.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_istft_destroy(fft10_istft* is) {
+    if(!is)
+    {
+        return;
+    }
+    fft10_plan_destroy(is->plan);
+    free(is->window);
+    free(is->acc);
+    free(is->norm);
+    free(is->work);
+    free(is->scratch);
+    free(is);
+}
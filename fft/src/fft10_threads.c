@@ -0,0 +1,487 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_threads.c
+ * Description: Work-stealing thread pool used to run independent parts of a
+ * transform (sub-transforms, chunks of a combine pass) on several cores.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - implement the pool and fft10_parallel_for
+ * 18.10.2026 - count queued tasks in the same critical section as the push
+ *
+ * ----------------------------------------------------------------------------
+ * Usage:
+ * ----------------------------------------------------------------------------
+ *     fft10_set_threads(8);       // once, before transforms are started
+ *     fft10_execute(plan, x, X);  // transforms above the cutoff use the pool
+ *
+ * ----------------------------------------------------------------------------
+ * Dependencies:
+ * ----------------------------------------------------------------------------
+ * pthreads. With FFT10_NO_THREADS everything runs on the calling thread.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Every worker owns a deque. It takes its own tasks from the back and steals
+ * from the front of the other deques when it runs dry. Tasks submitted from
+ * threads outside the pool go to a shared injection deque. A thread waiting for
+ * its tasks to finish runs queued tasks meanwhile, so nested fft10_parallel_for
+ * calls and calls from several application threads at once cannot deadlock.
+ *
+ * The split of the work never changes the arithmetic done for any output value,
+ * so results are bit for bit the same for every thread count.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "fft10_internal.h"
+
+#ifndef FFT10_NO_THREADS
+
+typedef struct task_group {
+    pthread_mutex_t  lock;
+    pthread_cond_t   done;
+    size_t           pending;
+} task_group;
+
+typedef struct {
+    fft10_task_fn  fn;
+    void*          arg;
+    size_t         index;
+    task_group*    group;
+} task;
+
+typedef struct {
+    pthread_mutex_t  lock;
+    task*            buf;
+    size_t           cap;   // power of 2
+    size_t           head;  // steal end
+    size_t           tail;  // owner end
+} task_deque;
+
+typedef struct worker {
+    pthread_t   thread;
+    task_deque  dq;
+    int         id;
+} worker;
+
+static worker*          workers     = NULL;
+static int              nworkers    = 0;     // threads of the pool besides the caller
+static task_deque       inject;
+static int              inject_init = 0;
+static pthread_mutex_t  pool_lock   = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t   pool_wake   = PTHREAD_COND_INITIALIZER;
+static size_t           queued      = 0;     // tasks sitting in any deque
+static int              stopping    = 0;
+
+static __thread worker* self = NULL;
+
+
+static int deque_init(task_deque* dq) {
+    dq->cap  = 64;
+    dq->head = 0;
+    dq->tail = 0;
+    dq->buf  = (task*)malloc(dq->cap*sizeof(task));
+    if(!dq->buf)
+    {
+        return -1;
+    }
+    pthread_mutex_init(&dq->lock, NULL);
+    return 0;
+}
+
+static void deque_free(task_deque* dq) {
+    pthread_mutex_destroy(&dq->lock);
+    free(dq->buf);
+}
+
+// pushes count tasks at the owner end, returns -1 if the deque could not grow
+static int deque_push(task_deque* dq, const task* t, size_t count) {
+    pthread_mutex_lock(&dq->lock);
+    if(dq->tail - dq->head + count > dq->cap)
+    {
+        size_t cap = dq->cap;
+        while(dq->tail - dq->head + count > cap)
+        {
+            cap *= 2;
+        }
+        task* buf = (task*)malloc(cap*sizeof(task));
+        if(!buf)
+        {
+            pthread_mutex_unlock(&dq->lock);
+            return -1;
+        }
+        for(size_t i = dq->head; i != dq->tail; i++)
+        {
+            buf[i & (cap-1)] = dq->buf[i & (dq->cap-1)];
+        }
+        free(dq->buf);
+        dq->buf = buf;
+        dq->cap = cap;
+    }
+    // pushed in reverse so that the owner pops them in index order
+    for(size_t i = count; i-- > 0; )
+    {
+        dq->buf[dq->tail++ & (dq->cap-1)] = t[i];
+    }
+    pthread_mutex_unlock(&dq->lock);
+    return 0;
+}
+
+static int deque_pop(task_deque* dq, task* t) {
+    int ok = 0;
+
+    pthread_mutex_lock(&dq->lock);
+    if(dq->tail != dq->head)
+    {
+        *t = dq->buf[--dq->tail & (dq->cap-1)];
+        ok = 1;
+    }
+    pthread_mutex_unlock(&dq->lock);
+    return ok;
+}
+
+static int deque_steal(task_deque* dq, task* t) {
+    int ok = 0;
+
+    pthread_mutex_lock(&dq->lock);
+    if(dq->tail != dq->head)
+    {
+        *t = dq->buf[dq->head++ & (dq->cap-1)];
+        ok = 1;
+    }
+    pthread_mutex_unlock(&dq->lock);
+    return ok;
+}
+
+// own deque first, then the injection deque, then the other workers
+static int take_task(task* t) {
+    int ok  = 0;
+    int own = self ? self->id : -1;
+
+    if(own >= 0)
+    {
+        ok = deque_pop(&workers[own].dq, t);
+    }
+    if(!ok)
+    {
+        ok = deque_steal(&inject, t);
+    }
+    for(int i = 1; !ok && i <= nworkers; i++)
+    {
+        int victim = (own + i) % nworkers;
+        if(victim < 0)
+        {
+            victim += nworkers;
+        }
+        if(victim != own)
+        {
+            ok = deque_steal(&workers[victim].dq, t);
+        }
+    }
+    if(ok)
+    {
+        pthread_mutex_lock(&pool_lock);
+        queued--;
+        pthread_mutex_unlock(&pool_lock);
+    }
+    return ok;
+}
+
+static void run_task(const task* t) {
+    t->fn(t->arg, t->index);
+
+    pthread_mutex_lock(&t->group->lock);
+    if(--t->group->pending == 0)
+    {
+        pthread_cond_broadcast(&t->group->done);
+    }
+    pthread_mutex_unlock(&t->group->lock);
+}
+
+static void* worker_main(void* arg) {
+    task t;
+
+    self = (worker*)arg;
+    for(;;)
+    {
+        pthread_mutex_lock(&pool_lock);
+        while(queued == 0 && !stopping)
+        {
+            pthread_cond_wait(&pool_wake, &pool_lock);
+        }
+        if(stopping)
+        {
+            pthread_mutex_unlock(&pool_lock);
+            break;
+        }
+        pthread_mutex_unlock(&pool_lock);
+
+        if(take_task(&t))
+        {
+            run_task(&t);
+        }
+    }
+    return NULL;
+}
+
+static void pool_stop(void) {
+    pthread_mutex_lock(&pool_lock);
+    stopping = 1;
+    pthread_cond_broadcast(&pool_wake);
+    pthread_mutex_unlock(&pool_lock);
+
+    for(int i = 0; i < nworkers; i++)
+    {
+        pthread_join(workers[i].thread, NULL);
+        deque_free(&workers[i].dq);
+    }
+    free(workers);
+    workers  = NULL;
+    nworkers = 0;
+    stopping = 0;
+}
+
+/*
+ * Function: fft10_set_threads
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Sets the number of threads used by transforms, the calling thread
+ *     included. The pool is shared by all plans and all application threads.
+ *
+ * Parameters:
+ *     int nthreads:
+ *         Number of threads, 1 (or less) runs everything on the calling thread.
+ *
+ * Returns:
+ *     The number of threads available afterwards.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Must not be called while transforms are running.
+ *
+ * ----------------------------------------------------------------------------
+ */
+int fft10_set_threads(int nthreads) {
+    if(nthreads < 1)
+    {
+        nthreads = 1;
+    }
+    if(nworkers > 0)
+    {
+        pool_stop();
+    }
+    if(!inject_init)
+    {
+        if(deque_init(&inject))
+        {
+            return 1;
+        }
+        inject_init = 1;
+    }
+    if(nthreads == 1)
+    {
+        return 1;
+    }
+
+    workers = (worker*)calloc((size_t)(nthreads-1), sizeof(worker));
+    if(!workers)
+    {
+        return 1;
+    }
+    for(int i = 0; i < nthreads-1; i++)
+    {
+        workers[i].id = i;
+        if(deque_init(&workers[i].dq))
+        {
+            break;
+        }
+        if(pthread_create(&workers[i].thread, NULL, worker_main, &workers[i]))
+        {
+            deque_free(&workers[i].dq);
+            break;
+        }
+        nworkers++;
+    }
+    return nworkers + 1;
+}
+
+int fft10_get_threads(void) {
+    return nworkers + 1;
+}
+
+/*
+ * Runs fn(arg, i) for i = 0..count-1 on the pool and returns when all of them
+ * are done. The calling thread takes part in the work.
+ */
+void fft10_parallel_for(size_t count, fft10_task_fn fn, void* arg) {
+    task        local[32];
+    task*       tasks = local;
+    task_group  group;
+    task        t;
+    int         pushed = 0;
+
+    if(nworkers == 0 || count < 2)
+    {
+        for(size_t i = 0; i < count; i++)
+        {
+            fn(arg, i);
+        }
+        return;
+    }
+
+    if(count > sizeof(local)/sizeof(local[0]))
+    {
+        tasks = (task*)malloc(count*sizeof(task));
+    }
+    pthread_mutex_init(&group.lock, NULL);
+    pthread_cond_init(&group.done, NULL);
+    group.pending = count;
+    if(tasks)
+    {
+        for(size_t i = 0; i < count; i++)
+        {
+            tasks[i].fn    = fn;
+            tasks[i].arg   = arg;
+            tasks[i].index = i;
+            tasks[i].group = &group;
+        }
+    }
+    if(tasks)
+    {
+        // counted in the same critical section as the push: a worker may take a
+        // task right away and must not decrement queued before it was counted
+        pthread_mutex_lock(&pool_lock);
+        pushed = deque_push(self ? &self->dq : &inject, tasks, count) == 0;
+        if(pushed)
+        {
+            queued += count;
+            pthread_cond_broadcast(&pool_wake);
+        }
+        pthread_mutex_unlock(&pool_lock);
+    }
+    if(!pushed)
+    {
+        // out of memory: run serially
+        for(size_t i = 0; i < count; i++)
+        {
+            fn(arg, i);
+        }
+        if(tasks != local)
+        {
+            free(tasks);
+        }
+        pthread_cond_destroy(&group.done);
+        pthread_mutex_destroy(&group.lock);
+        return;
+    }
+
+    // help until every task of this group has finished
+    for(;;)
+    {
+        pthread_mutex_lock(&group.lock);
+        size_t pending = group.pending;
+        pthread_mutex_unlock(&group.lock);
+        if(pending == 0)
+        {
+            break;
+        }
+        if(take_task(&t))
+        {
+            run_task(&t);
+            continue;
+        }
+        // nothing left to take, the remaining tasks run on other threads
+        pthread_mutex_lock(&group.lock);
+        while(group.pending > 0)
+        {
+            pthread_cond_wait(&group.done, &group.lock);
+        }
+        pthread_mutex_unlock(&group.lock);
+    }
+
+    if(tasks != local)
+    {
+        free(tasks);
+    }
+    pthread_cond_destroy(&group.done);
+    pthread_mutex_destroy(&group.lock);
+}
+
+#else
+
+int fft10_set_threads(int nthreads) {
+    (void)nthreads;
+    return 1;
+}
+
+int fft10_get_threads(void) {
+    return 1;
+}
+
+void fft10_parallel_for(size_t count, fft10_task_fn fn, void* arg) {
+    for(size_t i = 0; i < count; i++)
+    {
+        fn(arg, i);
+    }
+}
+
+#endif
+
+typedef struct {
+    const fft10_plan*  plan;
+    int                s;
+    float*             x;
+    size_t             m;
+    size_t             chunk;
+} pass_args;
+
+static void pass_chunk(void* arg, size_t i) {
+    pass_args* a    = (pass_args*)arg;
+    size_t     k0   = i*a->chunk;
+    size_t     k1   = k0 + a->chunk < a->m ? k0 + a->chunk : a->m;
+
+    fft10_pass_range(a->plan, a->s, a->x, k0, k1);
+}
+
+/*
+ * Combine pass of stage s with the k range split over the pool. Chunks start at
+ * multiples of FFT10_KALIGN so every k runs through the same kernel as in a
+ * serial pass.
+ */
+void fft10_pass_parallel(const fft10_plan* plan, int s, float* x) {
+    pass_args a;
+    size_t    nchunks;
+
+    a.plan  = plan;
+    a.s     = s;
+    a.x     = x;
+    a.m     = plan->span[s]/(size_t)plan->radix[s];
+    a.chunk = a.m/(4*(size_t)fft10_get_threads());
+    if(a.chunk < FFT10_THREAD_MIN_CHUNK)
+    {
+        a.chunk = FFT10_THREAD_MIN_CHUNK;
+    }
+    a.chunk = (a.chunk + FFT10_KALIGN-1)/FFT10_KALIGN*FFT10_KALIGN;
+    nchunks = (a.m + a.chunk-1)/a.chunk;
+
+    fft10_parallel_for(nchunks, pass_chunk, &a);
+}
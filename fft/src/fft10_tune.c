@@ -0,0 +1,459 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_tune.c
+ * Description: Measuring planner. For FFT10_MEASURE plans the candidate
+ * decompositions of n (radix choice and order, codelets on or off, recursive
+ * or iterative engine) are built, timed on this machine and the fastest is
+ * kept. The decisions ("wisdom") can be written to a small text file and read
+ * back by a later process, which then builds the same plans without timing.
+ * ----------------------------------------------------------------------------
+ *
+ * Author: Sharif Azem
+ * GitHub: sAz-G
+ *
+ * ----------------------------------------------------------------------------
+ * Date Created: 18.10.2026
+ * Last Modified: 18.10.2026
+ * ----------------------------------------------------------------------------
+ *
+ * License: MIT
+ *
+ * ----------------------------------------------------------------------------
+ *
+ * Change Log:
+ * ----------------------------------------------------------------------------
+ * 18.10.2026 - add FFT10_MEASURE and wisdom export/import
+ * 18.10.2026 - define _POSIX_C_SOURCE for clock_gettime under -std=c99
+ *
+ * ----------------------------------------------------------------------------
+ * Usage:
+ * ----------------------------------------------------------------------------
+ *     fft10_wisdom_import("fft10.wisdom");          // fails harmlessly the first time
+ *     fft10_plan* p = fft10_plan_create(1000, FFT10_MEASURE);
+ *     fft10_wisdom_export("fft10.wisdom");
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Wisdom is keyed by the length, the forced engine flags and the instruction
+ * set of the kernels, so a file written on one machine is only used for the
+ * same ISA. Direction and normalization do not change the decision. The file
+ * holds one line per decision:
+ *     n isa flags codelets engine nstages radix_0 ... radix_nstages-1
+ * after a "fft10-wisdom 1" header line.
+ *
+ * Only complex float plans of 5-smooth lengths are measured. Real plans
+ * measure their complex half length plans, Bluestein, double and fixed point
+ * plans are built as with FFT10_ESTIMATE.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#define _POSIX_C_SOURCE 199309L     // clock_gettime under -std=c99
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "fft10_internal.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#define TUNE_MAX_CANDIDATES  32
+#define TUNE_ROUNDS          3
+
+// flags that change the decision of the planner
+#define FFT10_WISDOM_KEY_MASK  (FFT10_RECURSIVE | FFT10_ITERATIVE)
+
+typedef struct fft10_wisdom {
+    size_t               n;
+    unsigned             key;
+    int                  isa;
+    fft10_shape          shape;
+    struct fft10_wisdom* next;
+} fft10_wisdom;
+
+static fft10_wisdom*  wisdom      = NULL;
+static fft10_mutex    wisdom_lock = FFT10_MUTEX_INITIALIZER;
+
+static double now_seconds(void) {
+#ifdef _WIN32
+    LARGE_INTEGER f, c;
+    QueryPerformanceFrequency(&f);
+    QueryPerformanceCounter(&c);
+    return (double)c.QuadPart/(double)f.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1e-9*(double)ts.tv_nsec;
+#endif
+}
+
+static int shape_equal(const fft10_shape* a, const fft10_shape* b) {
+    return a->nstages == b->nstages && a->codelets == b->codelets && a->engine == b->engine &&
+           memcmp(a->radix, b->radix, (size_t)a->nstages*sizeof(int)) == 0;
+}
+
+/* decision for (n, key) on the current ISA, returns 0 if there is none */
+static int wisdom_find(size_t n, unsigned key, fft10_shape* shape) {
+    int isa   = fft10_get_isa();
+    int found = 0;
+
+    fft10_mutex_lock(&wisdom_lock);
+    for(fft10_wisdom* w = wisdom; w; w = w->next)
+    {
+        if(w->n == n && w->key == key && w->isa == isa)
+        {
+            *shape = w->shape;
+            found  = 1;
+            break;
+        }
+    }
+    fft10_mutex_unlock(&wisdom_lock);
+    return found;
+}
+
+/* adds the entries of list, replacing older decisions for the same key */
+static void wisdom_merge(fft10_wisdom* list) {
+    fft10_mutex_lock(&wisdom_lock);
+    while(list)
+    {
+        fft10_wisdom*  next = list->next;
+        fft10_wisdom** link = &wisdom;
+
+        while(*link && !((*link)->n == list->n && (*link)->key == list->key && (*link)->isa == list->isa))
+        {
+            link = &(*link)->next;
+        }
+        if(*link)
+        {
+            fft10_wisdom* old = *link;
+            list->next = old->next;
+            free(old);
+        }
+        else
+        {
+            list->next = NULL;
+        }
+        *link = list;
+        list  = next;
+    }
+    fft10_mutex_unlock(&wisdom_lock);
+}
+
+/* the candidate shapes of n, returns their number */
+static int tune_candidates(size_t n, unsigned flags, fft10_shape* cand) {
+    static const unsigned engines[2] = { FFT10_RECURSIVE, FFT10_ITERATIVE };
+    int count = 0;
+
+    for(unsigned variant = 0; variant < 8; variant++)
+    {
+        fft10_shape shape;
+
+        if(!fft10_factor(n, variant, &shape))
+        {
+            continue;
+        }
+        // codelets only matter for shapes with a leading radix 10 stage
+        for(int c = 0; c < (shape.radix[0] == 10 ? 2 : 1); c++)
+        {
+            shape.codelets = c ? 0 : 3;
+            // a forced engine is kept, it is not part of the search
+            for(int e = 0; e < ((flags & FFT10_WISDOM_KEY_MASK) ? 1 : 2); e++)
+            {
+                int dup = 0;
+
+                shape.engine = (flags & FFT10_WISDOM_KEY_MASK) ? 0 : engines[e];
+                for(int i = 0; i < count && !dup; i++)
+                {
+                    dup = shape_equal(&cand[i], &shape);
+                }
+                if(!dup && count < TUNE_MAX_CANDIDATES)
+                {
+                    cand[count++] = shape;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+/* best time of TUNE_ROUNDS rounds of at least FFT10_MEASURE_SECONDS of plan */
+static double tune_time(const fft10_plan* plan, const float* in, float* out) {
+    double best = 0.0;
+
+    fft10_execute(plan, in, out);
+    for(int r = 0; r < TUNE_ROUNDS; r++)
+    {
+        size_t iters = 1;
+        double t;
+        for(;;)
+        {
+            double t0 = now_seconds();
+            for(size_t i = 0; i < iters; i++)
+            {
+                fft10_execute(plan, in, out);
+            }
+            t = now_seconds() - t0;
+            if(t >= FFT10_MEASURE_SECONDS)
+            {
+                break;
+            }
+            iters *= 2;
+        }
+        t /= (double)iters;
+        best = (r == 0 || t < best) ? t : best;
+    }
+    return best;
+}
+
+/*
+ * Plan of length n for FFT10_MEASURE: built from the wisdom if it has a
+ * decision for n, otherwise every candidate shape is timed and the fastest
+ * plan is returned and recorded. Plans that are not measured are built as
+ * with FFT10_ESTIMATE.
+ */
+fft10_plan* fft10_tune_build(size_t n, unsigned flags) {
+    unsigned      key = flags & FFT10_WISDOM_KEY_MASK;
+    fft10_shape   shape;
+    fft10_shape*  cand;
+    fft10_plan*   best = NULL;
+    fft10_wisdom* entry;
+    double        best_time = 0.0;
+    float*        buf;
+    int           count;
+
+    if((flags & (FFT10_REAL | FFT10_PRECISION_MASK)) || !fft10_factor(n, 0, &shape) || shape.nstages < 2)
+    {
+        return fft10_plan_build(n, flags, NULL);
+    }
+    if(wisdom_find(n, key, &shape))
+    {
+        return fft10_plan_build(n, flags, &shape);
+    }
+
+    cand = (fft10_shape*)malloc(TUNE_MAX_CANDIDATES*sizeof(fft10_shape));
+    buf  = (float*)malloc(4*n*sizeof(float));
+    if(!cand || !buf)
+    {
+        free(cand);
+        free(buf);
+        return fft10_plan_build(n, flags, NULL);
+    }
+    for(size_t j = 0; j < 2*n; j++)
+    {
+        buf[j] = (float)(j % 7) - 3.0f;
+    }
+
+    count = tune_candidates(n, flags, cand);
+    for(int i = 0; i < count; i++)
+    {
+        fft10_plan* plan = fft10_plan_build(n, flags, &cand[i]);
+        double      t;
+
+        if(!plan)
+        {
+            continue;
+        }
+        t = tune_time(plan, buf, buf + 2*n);
+        if(!best || t < best_time)
+        {
+            if(best)
+            {
+                fft10_plan_free(best);
+            }
+            best      = plan;
+            best_time = t;
+            shape     = cand[i];
+        }
+        else
+        {
+            fft10_plan_free(plan);
+        }
+    }
+    free(cand);
+    free(buf);
+    if(!best)
+    {
+        return NULL;
+    }
+
+    entry = (fft10_wisdom*)malloc(sizeof(*entry));
+    if(entry)
+    {
+        entry->n     = n;
+        entry->key   = key;
+        entry->isa   = fft10_get_isa();
+        entry->shape = shape;
+        entry->next  = NULL;
+        wisdom_merge(entry);
+    }
+    return best;
+}
+
+/*
+ * Function: fft10_wisdom_export
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Writes the decisions of every FFT10_MEASURE plan built so far (and of
+ *     imported wisdom) to a text file.
+ *
+ * Parameters:
+ *     const char* path:
+ *         The file to write, replaced if it exists.
+ *
+ * Returns:
+ *     0 on success, -1 if the file could not be written.
+ *
+ * ----------------------------------------------------------------------------
+ */
+int fft10_wisdom_export(const char* path) {
+    FILE* f = fopen(path, "w");
+    int   ok;
+
+    if(!f)
+    {
+        return -1;
+    }
+    fprintf(f, "fft10-wisdom 1\n");
+    fft10_mutex_lock(&wisdom_lock);
+    for(fft10_wisdom* w = wisdom; w; w = w->next)
+    {
+        fprintf(f, "%zu %d %u %d %u %d", w->n, w->isa, w->key, w->shape.codelets, w->shape.engine, w->shape.nstages);
+        for(int s = 0; s < w->shape.nstages; s++)
+        {
+            fprintf(f, " %d", w->shape.radix[s]);
+        }
+        fprintf(f, "\n");
+    }
+    fft10_mutex_unlock(&wisdom_lock);
+    ok = !ferror(f);
+    ok = fclose(f) == 0 && ok;
+    return ok ? 0 : -1;
+}
+
+/* reads one entry of a wisdom file into w, returns 0 at the end of the file and -1 if it is malformed */
+static int wisdom_read(FILE* f, fft10_wisdom* w) {
+    unsigned long long n;
+    size_t             prod = 1;
+    int                got;
+
+    got = fscanf(f, "%llu %d %u %d %u %d", &n, &w->isa, &w->key, &w->shape.codelets, &w->shape.engine, &w->shape.nstages);
+    if(got == EOF)
+    {
+        return 0;
+    }
+    if(got != 6 || n == 0 || (w->key & ~FFT10_WISDOM_KEY_MASK) || w->shape.codelets < 0 || w->shape.codelets > 3 ||
+       (w->shape.engine != 0 && w->shape.engine != FFT10_RECURSIVE && w->shape.engine != FFT10_ITERATIVE) ||
+       w->shape.nstages < 1 || w->shape.nstages > FFT10_MAX_STAGES)
+    {
+        return -1;
+    }
+    for(int s = 0; s < w->shape.nstages; s++)
+    {
+        int r;
+        if(fscanf(f, "%d", &r) != 1 || (r != 2 && r != 3 && r != 4 && r != 5 && r != 8 && r != 10))
+        {
+            return -1;
+        }
+        w->shape.radix[s] = r;
+        prod *= (size_t)r;
+    }
+    w->n = (size_t)n;
+    return prod == w->n ? 1 : -1;
+}
+
+/*
+ * Function: fft10_wisdom_import
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Reads a file written by fft10_wisdom_export. Later FFT10_MEASURE plans of
+ *     a length found in the file are built from its decision without timing.
+ *
+ * Parameters:
+ *     const char* path:
+ *         The file to read.
+ *
+ * Returns:
+ *     0 on success, -1 if the file could not be read or is malformed; nothing
+ *     is imported in that case.
+ *
+ * ----------------------------------------------------------------------------
+ * Notes:
+ * ----------------------------------------------------------------------------
+ * Entries of another instruction set are kept but not used, see
+ * fft10_set_isa.
+ *
+ * ----------------------------------------------------------------------------
+ */
+int fft10_wisdom_import(const char* path) {
+    FILE*          f = fopen(path, "r");
+    fft10_wisdom*  list = NULL;
+    int            version = 0;
+    int            got = 1;
+
+    if(!f)
+    {
+        return -1;
+    }
+    if(fscanf(f, "fft10-wisdom %d", &version) != 1 || version != 1)
+    {
+        fclose(f);
+        return -1;
+    }
+    while(got > 0)
+    {
+        fft10_wisdom* w = (fft10_wisdom*)malloc(sizeof(*w));
+        got = w ? wisdom_read(f, w) : -1;
+        if(got > 0)
+        {
+            w->next = list;
+            list    = w;
+        }
+        else
+        {
+            free(w);
+        }
+    }
+    fclose(f);
+
+    if(got < 0)
+    {
+        while(list)
+        {
+            fft10_wisdom* next = list->next;
+            free(list);
+            list = next;
+        }
+        return -1;
+    }
+    wisdom_merge(list);
+    return 0;
+}
+
+/*
+ * Function: fft10_wisdom_forget
+ * ----------------------------------------------------------------------------
+ * Description:
+ *     Drops all wisdom. Plans built before stay as they are.
+ *
+ * ----------------------------------------------------------------------------
+ */
+void fft10_wisdom_forget(void) {
+    fft10_wisdom* list;
+
+    fft10_mutex_lock(&wisdom_lock);
+    list   = wisdom;
+    wisdom = NULL;
+    fft10_mutex_unlock(&wisdom_lock);
+
+    while(list)
+    {
+        fft10_wisdom* next = list->next;
+        free(list);
+        list = next;
+    }
+}
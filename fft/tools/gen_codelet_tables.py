@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+# ----------------------------------------------------------------------------
+# Project Name: fft radix 10 implementation
+# File: gen_codelet_tables.py
+# Description: Writes fft10_codelets.inc, the constant twiddle tables of the
+# unrolled 100 and 1000 point codelets in fft10_kernels.c.
+# ----------------------------------------------------------------------------
+#
+# Author: Sharif Azem
+# GitHub: sAz-G
+#
+# ----------------------------------------------------------------------------
+# Usage:
+# ----------------------------------------------------------------------------
+#     python3 gen_codelet_tables.py > ../src/fft10_codelets.inc
+#
+# ----------------------------------------------------------------------------
+# Notes:
+# ----------------------------------------------------------------------------
+# The values are W_L^(r*k) = exp(-2*pi*i*r*k/L) in the [r-1][k] layout of
+# fft10_plan.tw. The angle is evaluated in double precision in the order of
+# fft10_plan_build, step = -2*pi/L and then step*(r*k), and rounded once to
+# float, so with the same libm the tables agree bit for bit with the plan
+# tables of the forward 100 and 1000 point plans.
+#
+# ----------------------------------------------------------------------------
+
+import math
+import struct
+
+def f32(x):
+    return struct.unpack('f', struct.pack('f', x))[0]
+
+def table(L):
+    m = L // 10
+    step = -1.0 * 2.0 * math.pi / float(L)
+    vals = []
+    for r in range(1, 10):
+        for k in range(m):
+            ang = step * float(r * k)
+            vals += [f32(math.cos(ang)), f32(math.sin(ang))]
+    return vals
+
+print("""/*
+ * ----------------------------------------------------------------------------
+ * Project Name: fft radix 10 implementation
+ * File: fft10_codelets.inc
+ * Description: Twiddle tables of the 100 and 1000 point codelets, generated by
+ * fft/tools/gen_codelet_tables.py. Do not edit.
+ * ----------------------------------------------------------------------------
+ *
+ * fft10_tw100[2*((r-1)*10 + k)]   = W_100^(r*k),  r = 1..9, k = 0..9
+ * fft10_tw1000[2*((r-1)*100 + k)] = W_1000^(r*k), r = 1..9, k = 0..99
+ *
+ * ----------------------------------------------------------------------------
+ */
+""")
+for L in (100, 1000):
+    vals = table(L)
+    print("static const float fft10_tw%d[%d] = {" % (L, len(vals)))
+    for i in range(0, len(vals), 4):
+        row = ", ".join("%.9ef" % v for v in vals[i:i+4])
+        print("    " + row + ("," if i + 4 < len(vals) else ""))
+    print("};")
+    print()